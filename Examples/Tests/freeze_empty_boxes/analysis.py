@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script checking that skipping the field update in the boxes
+# --- far from particles and fields (warpx.freeze_empty_boxes) does not change
+# --- the results, by comparing with the output of the reference test. The
+# --- injected particles appear in boxes that are frozen at the time of the
+# --- injection, which must then be reactivated.
+
+import os
+
+import numpy as np
+import yt
+from analysis_compare_runs import compare_runs, get_parser
+
+yt.funcs.mylog.setLevel(50)
+
+parser = get_parser()
+parser.set_defaults(fields=["Ex", "Ey", "Ez", "Bx", "By", "Bz", "jx", "jy", "jz"])
+args = parser.parse_args()
+
+compare_runs(args.path, args.reference, args.fields, args.rtol)
+
+# The injected particles must be present, and identical in both runs
+ad_all = yt.load(args.path).all_data()
+ad_all_ref = yt.load(os.path.join(args.reference, args.path)).all_data()
+z = ad_all[("injected", "particle_position_y")].to_ndarray()
+z_ref = ad_all_ref[("injected", "particle_position_y")].to_ndarray()
+print(f"number of injected particles: {z.size} (reference {z_ref.size})")
+assert z.size > 0, "no particles were injected"
+assert z.size == z_ref.size, "the number of injected particles differs"
+assert np.allclose(np.sort(z), np.sort(z_ref), rtol=0.0, atol=1e-12 * 40.0e-6)
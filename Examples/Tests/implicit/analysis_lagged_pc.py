@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script for the lagged preconditioner of the Newton solver
+# --- (newton.lag_preconditioner): the preconditioner must be updated fewer
+# --- times than there are Newton iterations, its updates must be written to
+# --- the diagnostic file (and only then), and the converged fields must agree
+# --- with the test that updates the preconditioner at each iteration.
+
+import os
+
+import numpy as np
+from analysis_compare_runs import compare_runs, get_parser
+
+parser = get_parser()
+parser.set_defaults(rtol=1e-6, fields=["Ex", "Ey", "Ez", "Bx", "By", "Bz"])
+args = parser.parse_args()
+
+newton_file = "diags/reduced_files/newton_solver.txt"
+newton_solver = np.loadtxt(newton_file, ndmin=2)
+newton_solver_ref = np.loadtxt(os.path.join(args.reference, newton_file), ndmin=2)
+
+# The two preconditioner columns are only written with the lagged preconditioner
+assert newton_solver.shape[1] == newton_solver_ref.shape[1] + 2
+with open(newton_file) as f:
+    header = f.readline()
+assert "pc_updates" in header and "pc_total_updates" in header
+
+total_newton_iters = newton_solver[-1, 3]
+total_pc_updates = newton_solver[-1, 10]
+print(f"Newton iterations: {total_newton_iters}, preconditioner updates: {total_pc_updates}")
+assert total_pc_updates >= 1
+assert total_pc_updates < total_newton_iters
+assert np.all(newton_solver[:, 9] <= newton_solver[:, 2])
+
+compare_runs(args.path, args.reference, args.fields, args.rtol)
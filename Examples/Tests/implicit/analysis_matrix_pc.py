@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script for the native matrix preconditioner (jacobian.pc_type =
+# --- pc_matrix): the Newton solver must converge at every step and the fields
+# --- must agree with the test preconditioned by pc_curl_curl_mlmg.
+
+import numpy as np
+from analysis_compare_runs import compare_runs, get_parser
+
+parser = get_parser()
+parser.add_argument(
+    "--newton_rtol", help="Newton relative tolerance", type=float, default=1e-10
+)
+parser.set_defaults(rtol=1e-6, fields=["Ex", "Ey", "Ez", "Bx", "By", "Bz"])
+args = parser.parse_args()
+
+newton_file = "diags/reduced_files/newton_solver.txt"
+newton_solver = np.loadtxt(newton_file, ndmin=2)
+print(f"Newton iterations: {newton_solver[-1, 3]}, GMRES iterations: {newton_solver[-1, 7]}")
+assert newton_solver[-1, 7] > 0
+assert np.all(newton_solver[:, 5] <= args.newton_rtol), "Newton solver did not converge"
+
+compare_runs(args.path, args.reference, args.fields, args.rtol)
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script for the Anderson acceleration of the Picard solver
+# --- (picard.anderson_depth): with the same tolerance, it must converge in
+# --- fewer iterations than the plain Picard iterations of the reference test,
+# --- conserve the energy and give the same fields.
+
+import os
+
+import numpy as np
+from analysis_compare_runs import compare_runs, get_parser
+
+parser = get_parser()
+parser.set_defaults(rtol=1e-8, fields=["Ex", "Ey", "Ez", "Bx", "By"])
+args = parser.parse_args()
+
+picard_file = "diags/reducedfiles/picard_solver.txt"
+picard = np.loadtxt(picard_file, ndmin=2)
+picard_ref = np.loadtxt(os.path.join(args.reference, picard_file), ndmin=2)
+
+total_iters = picard[-1, 3]
+total_iters_ref = picard_ref[-1, 3]
+print(f"Picard iterations: {total_iters} with Anderson, {total_iters_ref} without")
+assert total_iters < total_iters_ref
+
+field_energy = np.loadtxt("diags/reducedfiles/field_energy.txt", skiprows=1)
+particle_energy = np.loadtxt("diags/reducedfiles/particle_energy.txt", skiprows=1)
+total_energy = field_energy[:, 2] + particle_energy[:, 2]
+max_delta_E = np.abs((total_energy - total_energy[0]) / total_energy[0]).max()
+print(f"max change in energy: {max_delta_E}")
+assert max_delta_E < 1.0e-10
+
+compare_runs(args.path, args.reference, args.fields, args.rtol)
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script for the WarpX GMRES linear solver (newton.linear_solver =
+# --- warpx_gmres): it is compared with the test using amrex_gmres. The Newton
+# --- solver must converge, with a similar number of GMRES iterations, and the
+# --- fields must agree.
+
+import os
+
+import numpy as np
+from analysis_compare_runs import compare_runs, get_parser
+
+parser = get_parser()
+parser.set_defaults(rtol=1e-6, fields=["Ex", "Ey", "Ez", "Bx", "By", "Bz"])
+args = parser.parse_args()
+
+newton_file = "diags/reduced_files/newton_solver.txt"
+newton_solver = np.loadtxt(newton_file, ndmin=2)
+newton_solver_ref = np.loadtxt(os.path.join(args.reference, newton_file), ndmin=2)
+
+newton_iters, gmres_iters = newton_solver[-1, 3], newton_solver[-1, 7]
+newton_iters_ref, gmres_iters_ref = newton_solver_ref[-1, 3], newton_solver_ref[-1, 7]
+print(f"warpx_gmres: {newton_iters} Newton iterations, {gmres_iters} GMRES iterations")
+print(f"amrex_gmres: {newton_iters_ref} Newton iterations, {gmres_iters_ref} GMRES iterations")
+assert np.all(newton_solver[:, 5] <= newton_solver_ref[:, 5].max() * 10.0)
+assert newton_iters <= newton_iters_ref + 1
+assert gmres_iters <= 1.1 * gmres_iters_ref + 1
+
+compare_runs(args.path, args.reference, args.fields, args.rtol)
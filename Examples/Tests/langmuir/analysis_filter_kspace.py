@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script for the Langmuir tests with filtered current and charge
+# --- densities. With charge-conserving deposition, Gauss's law holds as long
+# --- as the current and charge densities are filtered in the same way.
+# --- Optionally, the fields are also compared with those of a test that uses
+# --- the real-space filter, which applies the same transfer function.
+
+import numpy as np
+import yt
+from analysis_compare_runs import compare_runs, get_parser
+from scipy.constants import epsilon_0
+
+yt.funcs.mylog.setLevel(50)
+
+parser = get_parser(reference_required=False)
+parser.set_defaults(
+    rtol=1e-5, fields=["Ex", "Ez", "Bx", "By", "Bz", "jx", "jz", "rho", "divE"]
+)
+args = parser.parse_args()
+
+ds = yt.load(args.path)
+ad = ds.covering_grid(level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions)
+rho = ad[("mesh", "rho")].to_ndarray()
+divE = ad[("mesh", "divE")].to_ndarray()
+
+# Gauss's law
+rho_max = np.max(np.abs(rho))
+assert rho_max > 0.0, "the charge density vanishes"
+error = np.max(np.abs(epsilon_0 * divE - rho))
+print(f"Gauss's law: max. error = {error:.3e} (max. abs. rho {rho_max:.3e})")
+assert error <= 1e-6 * rho_max, "Gauss's law is violated"
+
+# Comparison with the real-space filter
+if args.reference is not None:
+    compare_runs(args.path, args.reference, args.fields, args.rtol)
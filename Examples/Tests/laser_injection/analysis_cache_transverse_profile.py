@@ -0,0 +1,16 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script for the 2D laser injection test with the transverse
+# --- profile of the Gaussian laser cached on the antenna particles. The laser
+# --- must match the theory, as in the default test, and its fields must match
+# --- those of the default test up to the neglected motion of the antenna.
+
+from analysis_2d import check_laser
+from analysis_compare_runs import compare_runs, get_parser
+
+parser = get_parser()
+parser.set_defaults(rtol=1e-3, fields=["Ex", "Ey", "Ez", "Bx", "By", "Bz"])
+args = parser.parse_args()
+
+check_laser(args.path)
+compare_runs(args.path, args.reference, args.fields, args.rtol)
@@ -0,0 +1 @@
+../../analysis_compare_runs.py
\ No newline at end of file
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+#
+# --- Analysis script for the magnetostatic test with skipped solves.
+# --- The solves at initialization and at step 2 are done, while the solves of
+# --- steps 1 and 3 are skipped, so that the magnetic field of step 3 is the
+# --- same as at step 2.
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+
+def get_fields(step):
+    ds = yt.load(f"diags/diag1{step:06d}")
+    ad = ds.covering_grid(
+        level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions
+    )
+    return {field: ad[("mesh", field)].to_ndarray() for field in ["Bx", "By"]}
+
+
+B1 = get_fields(1)
+B2 = get_fields(2)
+B3 = get_fields(3)
+
+for field in ["Bx", "By"]:
+    scale = np.max(np.abs(B2[field]))
+    assert scale > 0.0, f"{field} vanishes"
+    # forced solve: the beam moved, so the field changes
+    diff_solved = np.max(np.abs(B2[field] - B1[field]))
+    print(f"{field}: difference between steps 1 and 2 = {diff_solved:.3e}")
+    assert diff_solved > 1e-12 * scale, f"{field} was not recomputed at step 2"
+    # skipped solve: the field of the last solve is reused as is
+    diff_skipped = np.max(np.abs(B3[field] - B2[field]))
+    print(f"{field}: difference between steps 2 and 3 = {diff_skipped:.3e}")
+    assert diff_skipped <= 1e-12 * scale, f"{field} was not reused at step 3"
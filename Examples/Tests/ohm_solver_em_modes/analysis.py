@@ -347,3 +347,24 @@ plt.savefig(
 )
 if not sim.test:
     plt.show()
+
+if getattr(sim, "adaptive_substeps", False):
+    # check the HybridPICSubsteps reduced diagnostic (single level):
+    # step, time, accepted, rejected, next substeps, dt_sub_min, dt_sub_max
+    substeps_data = np.loadtxt("diags/reducedfiles/substeps.txt", ndmin=2)
+    assert substeps_data.shape[1] == 7
+    accepted, rejected, next_substeps, dt_sub_min, dt_sub_max = substeps_data[
+        :, 2:
+    ].T
+
+    # the diagnostic is written after the first step, where substeps were taken
+    assert np.all(accepted >= 2)
+    assert np.all(rejected >= 0)
+    # the planned number of substeps is even (two half-steps)
+    assert np.all(next_substeps >= 2)
+    assert np.all(next_substeps % 2 == 0)
+    assert np.all(dt_sub_min > 0.0)
+    assert np.all(dt_sub_min <= dt_sub_max)
+    # the accepted substeps of the two half-steps cover the full timestep
+    assert np.all(accepted * dt_sub_max >= sim.dt * (1.0 - 1e-6))
+    assert np.all(accepted * dt_sub_min <= sim.dt * (1.0 + 1e-6))
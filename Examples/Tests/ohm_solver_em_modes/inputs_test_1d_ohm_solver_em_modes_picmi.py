@@ -58,13 +58,17 @@ class EMModes(object):
     # Number of substeps used to update B
     substeps = 40
 
-    def __init__(self, test, dim, B_dir, verbose, use_rkf45):
+    def __init__(
+        self, test, dim, B_dir, verbose, use_rkf45, adaptive_substeps, fuse_kernels
+    ):
         """Get input parameters for the specific case desired."""
         self.test = test
         self.dim = int(dim)
         self.B_dir = B_dir
         self.verbose = verbose or self.test
         self.use_rkf45 = use_rkf45
+        self.adaptive_substeps = adaptive_substeps
+        self.fuse_kernels = fuse_kernels
 
         # sanity check
         assert dim > 0 and dim < 4, f"{dim}-dimensions not a valid input"
@@ -218,6 +222,8 @@ class EMModes(object):
             plasma_resistivity=self.eta,
             substeps=self.substeps,
             use_rkf45=self.use_rkf45,
+            adaptive_substeps=self.adaptive_substeps,
+            fuse_substep_kernels=self.fuse_kernels,
         )
         simulation.solver = self.solver
 
@@ -274,6 +280,14 @@ class EMModes(object):
             )
             simulation.add_diagnostic(field_diag)
 
+        if self.adaptive_substeps:
+            substeps_diag = picmi.ReducedDiagnostic(
+                diag_type="HybridPICSubsteps",
+                name="substeps",
+                period=1,
+            )
+            simulation.add_diagnostic(substeps_diag)
+
         if self.B_dir == "z" or self.dim == 1:
             line_diag = picmi.ReducedDiagnostic(
                 diag_type="FieldProbe",
@@ -376,6 +390,16 @@ parser.add_argument(
     help="Use adaptive RKF45 subcycling for the B-field update",
     action="store_true",
 )
+parser.add_argument(
+    "--adaptive_substeps",
+    help="Adapt the number of B-field substeps at every step (RKF45 error controller)",
+    action="store_true",
+)
+parser.add_argument(
+    "--fuse_kernels",
+    help="Fuse the plasma current and Ohm's law kernels of the B-field substeps",
+    action="store_true",
+)
 args, left = parser.parse_known_args()
 sys.argv = sys.argv[:1] + left
 
@@ -385,5 +409,7 @@ run = EMModes(
     B_dir=args.bdir,
     verbose=args.verbose,
     use_rkf45=args.use_rkf45,
+    adaptive_substeps=args.adaptive_substeps,
+    fuse_kernels=args.fuse_kernels,
 )
 simulation.step()
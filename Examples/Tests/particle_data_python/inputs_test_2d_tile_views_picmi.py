@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# --- Test of the cached zero-copy views of the particle tiles (tile_views)
+# --- and of the FABs of a MultiFab (fab_views): the views must be reused
+# --- while the data layout is unchanged, rebuilt after the particles are
+# --- redistributed, and released with the object they view.
+
+import gc
+import weakref
+
+import numpy as np
+
+from pywarpx import picmi
+from pywarpx.extensions.MultiFab import _fab_views_cache
+from pywarpx.extensions.WarpXParticleContainer import _tile_views_cache
+
+constants = picmi.constants
+
+##########################
+# numerics components
+##########################
+
+nx = 32
+nz = 32
+
+grid = picmi.Cartesian2DGrid(
+    number_of_cells=[nx, nz],
+    lower_bound=[0.0, 0.0],
+    upper_bound=[32.0e-6, 32.0e-6],
+    lower_boundary_conditions=["periodic", "periodic"],
+    upper_boundary_conditions=["periodic", "periodic"],
+    lower_boundary_conditions_particles=["periodic", "periodic"],
+    upper_boundary_conditions_particles=["periodic", "periodic"],
+    warpx_max_grid_size=16,
+)
+
+solver = picmi.ElectromagneticSolver(grid=grid, method="Yee", cfl=0.99)
+
+##########################
+# physics components
+##########################
+
+# slab of electrons drifting along x, across the box boundary at x = 16 um
+electron_dist = picmi.UniformDistribution(
+    density=1.0e24,
+    lower_bound=[0.0, None, 0.0],
+    upper_bound=[12.0e-6, None, 32.0e-6],
+    directed_velocity=[3.0 * constants.c, 0.0, 0.0],
+)
+electrons = picmi.Species(
+    particle_type="electron", name="electrons", initial_distribution=electron_dist
+)
+
+##########################
+# simulation setup
+##########################
+
+sim = picmi.Simulation(solver=solver, max_steps=10, verbose=1)
+
+sim.add_species(
+    electrons, layout=picmi.GriddedLayout(n_macroparticle_per_cell=[2, 2], grid=grid)
+)
+
+sim.initialize_inputs()
+sim.initialize_warpx()
+
+##########################
+# particle tile views
+##########################
+
+electrons = sim.particles.get("electrons")
+
+
+def check_tile_views(views):
+    """The views must match the particle data and share its memory"""
+    assert len(views) == len(list(electrons.iterator(level=0)))
+    for tile, pti in zip(views, electrons.iterator(level=0)):
+        assert np.array_equal(tile["w"], pti["w"])
+        tile["uy"][:] = 1.0
+        assert np.all(np.asarray(pti["uy"]) == 1.0)
+        tile["uy"][:] = 0.0
+
+
+views = electrons.tile_views(level=0)
+check_tile_views(views)
+assert electrons in _tile_views_cache
+
+# unchanged layout: the cached views are returned
+assert electrons.tile_views(level=0) is views
+assert next(iter(electrons.iterate_tiles(level=0))) is views[0]
+
+# the particles cross the box boundary, so their redistribution changes the layout
+layout = electrons.data_layout(0)
+sim.step(10)
+assert electrons.data_layout(0) != layout
+new_views = electrons.tile_views(level=0)
+assert new_views is not views
+check_tile_views(new_views)
+assert electrons.tile_views(level=0) is new_views
+
+# the cached views are released with the particle container wrapper
+electrons_ref = weakref.ref(electrons)
+del electrons, views, new_views
+gc.collect()
+assert electrons_ref() is None
+assert len(_tile_views_cache) == 0
+
+##########################
+# MultiFab views
+##########################
+
+Ex = sim.fields.get("Efield_fp", dir=0, level=0)
+fab_views = Ex.fab_views()
+assert len(fab_views) == len(list(Ex))
+for view, mfi in zip(fab_views, Ex):
+    assert view.shape == np.asarray(Ex.array(mfi)).shape
+assert Ex.fab_views() is fab_views
+assert Ex in _fab_views_cache
+
+Ex_ref = weakref.ref(Ex)
+del Ex, fab_views, view, mfi
+gc.collect()
+assert Ex_ref() is None
+assert len(_fab_views_cache) == 0
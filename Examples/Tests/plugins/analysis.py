@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+#
+# --- Analysis of test_2d_plugin: checks the effect of the hooks of the
+# --- example plugin (example_plugin.cpp) and the reduced diagnostic it defines.
+
+import sys
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+fn = sys.argv[1]
+ds = yt.load(fn)
+ad = ds.all_data()
+
+# particle hook: the y momentum of the electrons is removed after each step,
+# but not that of the positrons
+uy_electrons = ad["electrons", "particle_momentum_y"].to_ndarray()
+uy_positrons = ad["positrons", "particle_momentum_y"].to_ndarray()
+assert np.all(uy_electrons == 0.0)
+assert np.any(uy_positrons != 0.0)
+
+# reduced diagnostic: one call per step of the particle hook for each species,
+# and of the field hook for each level
+data = np.loadtxt("diags/reducedfiles/example.txt", ndmin=2)
+nsteps = data[:, 0]
+assert np.array_equal(data[:, 2], 2 * nsteps)
+assert np.array_equal(data[:, 3], nsteps)
+
+# field hook: maximum of |Ex| after the last step. The plotfile has Ex averaged
+# to the cell centers, which cannot exceed, and is close to, the maximum on the
+# staggered grid for this smooth wave.
+cg = ds.covering_grid(level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions)
+max_abs_Ex = np.max(np.abs(cg["boxlib", "Ex"].to_ndarray()))
+print(f"max |Ex|: {data[-1, 4]} from the plugin, {max_abs_Ex} from the plotfile")
+assert max_abs_Ex > 0.0
+assert max_abs_Ex <= data[-1, 4] * (1.0 + 1e-12)
+assert max_abs_Ex >= 0.95 * data[-1, 4]
@@ -0,0 +1,73 @@
+/* Copyright 2026 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+/* Example of a compiled plugin (see warpx.plugins), used by test_2d_plugin.
+ *
+ * It registers:
+ * - a particle hook that removes the y momentum of the electrons after each step,
+ * - a field hook that computes the maximum of |Ex| after each step,
+ * - a reduced diagnostic "example" that writes the number of calls of both
+ *   hooks and the maximum of |Ex|.
+ */
+
+#include <Particles/WarpXParticleContainer.H>
+#include <Utils/Plugins/WarpXPlugins.H>
+
+#include <ablastr/fields/MultiFabRegister.H>
+
+#include <AMReX_MultiFab.H>
+#include <AMReX_REAL.H>
+
+#include <string>
+#include <vector>
+
+using namespace amrex::literals;
+
+namespace
+{
+    using ParticleTileDataType = WarpXParticleContainer::ParticleTileType::ParticleTileDataType;
+
+    /** Number of calls of the hooks on this process */
+    long n_particle_hook_calls = 0;
+    long n_field_hook_calls = 0;
+    /** Maximum of |Ex| on level 0, computed by the field hook */
+    amrex::Real max_abs_Ex = 0.;
+}
+
+extern "C" void warpx_register_plugin (warpx::plugins::PluginRegistry& registry)
+{
+    registry.addParticleHook("zero_electron_uy",
+        [] (WarpXParticleContainer& pc, int lev, amrex::Real /*time*/, amrex::Real /*dt*/)
+        {
+            ++n_particle_hook_calls;
+            if (pc.getName() != "electrons") { return; }
+            warpx::plugins::ParallelForParticles(pc, lev,
+                [=] AMREX_GPU_DEVICE (ParticleTileDataType const& ptd, long ip)
+                {
+                    ptd.m_rdata[PIdx::uy][ip] = 0.0_prt;
+                });
+        });
+
+    registry.addFieldHook("max_abs_Ex",
+        [] (ablastr::fields::MultiFabRegister& fields, int lev, amrex::Real /*time*/, amrex::Real /*dt*/)
+        {
+            ++n_field_hook_calls;
+            if (lev != 0) { return; }
+            // norm0 includes the MPI reduction
+            max_abs_Ex = fields.get("Efield_fp", ablastr::fields::Direction{0}, lev)->norm0();
+        });
+
+    registry.addReducedDiag("example",
+        {"particle_hook_calls()", "field_hook_calls()", "max_abs_Ex(V/m)"},
+        [] (int /*step*/, std::vector<amrex::Real>& data)
+        {
+            // the hooks are called the same number of times on all processes
+            data[0] = static_cast<amrex::Real>(n_particle_hook_calls);
+            data[1] = static_cast<amrex::Real>(n_field_hook_calls);
+            data[2] = max_abs_Ex;
+        });
+}
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+#
+# --- Analysis of the PythonCallbackTiming reduced diagnostic written by
+# --- inputs_test_2d_python_callbacks_picmi.py: the number of calls and skipped
+# --- calls of each callback must match the steps at which it was executed
+# --- (afterstep every fifth step for the first 20 steps, then at every step).
+
+import numpy as np
+
+data = np.loadtxt("diags/reducedfiles/callback_timing.txt")
+with open("diags/reducedfiles/callback_timing.txt") as f:
+    header = f.readline().split()
+
+columns = {name.split("]", 1)[1]: i for i, name in enumerate(header)}
+# number of completed steps; each row is written after the afterstep callback
+nsteps = data[:, columns["step()"]]
+afterstep_ncalls = np.where(nsteps <= 20, nsteps // 5, 4 + (nsteps - 20))
+afterstep_nskipped = np.minimum(nsteps, 20) - np.minimum(nsteps, 20) // 5
+
+assert np.array_equal(data[:, columns["beforestep_ncalls()"]], nsteps)
+assert np.all(data[:, columns["beforestep_nskipped()"]] == 0)
+assert np.array_equal(data[:, columns["afterstep_ncalls()"]], afterstep_ncalls)
+assert np.array_equal(data[:, columns["afterstep_nskipped()"]], afterstep_nskipped)
+
+# the times are accumulated over the calls
+for name in ["beforestep", "afterstep"]:
+    total_time = data[:, columns[f"{name}_total_time(s)"]]
+    max_time = data[:, columns[f"{name}_max_time(s)"]]
+    assert np.all(np.diff(total_time) >= 0.0)
+    assert np.all(max_time <= total_time)
+    assert total_time[-1] > 0.0
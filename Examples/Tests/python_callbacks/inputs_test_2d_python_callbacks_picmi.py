@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+#
+# --- Test of the step intervals and of the timing statistics of the Python
+# --- callbacks: the afterstep callback is restricted to every fifth step, the
+# --- beforestep callback runs at every step. The statistics are checked here
+# --- with get_callback_stats, and in analysis.py from the PythonCallbackTiming
+# --- reduced diagnostic.
+
+from pywarpx import callbacks, libwarpx, picmi
+
+max_steps = 20
+
+##########################
+# numerics components
+##########################
+
+grid = picmi.Cartesian2DGrid(
+    number_of_cells=[32, 32],
+    lower_bound=[0.0, 0.0],
+    upper_bound=[32.0e-6, 32.0e-6],
+    lower_boundary_conditions=["periodic", "periodic"],
+    upper_boundary_conditions=["periodic", "periodic"],
+    lower_boundary_conditions_particles=["periodic", "periodic"],
+    upper_boundary_conditions_particles=["periodic", "periodic"],
+    warpx_max_grid_size=16,
+)
+
+solver = picmi.ElectromagneticSolver(grid=grid, method="Yee", cfl=0.99)
+
+##########################
+# physics components
+##########################
+
+electrons = picmi.Species(
+    particle_type="electron",
+    name="electrons",
+    initial_distribution=picmi.UniformDistribution(
+        density=1.0e24, rms_velocity=[0.01 * picmi.constants.c] * 3
+    ),
+)
+
+##########################
+# diagnostics
+##########################
+
+callback_timing = picmi.ReducedDiagnostic(
+    diag_type="PythonCallbackTiming",
+    name="callback_timing",
+    period=1,
+    callback_names=["beforestep", "afterstep"],
+)
+
+##########################
+# simulation setup
+##########################
+
+sim = picmi.Simulation(solver=solver, max_steps=max_steps, verbose=1)
+
+sim.add_species(
+    electrons, layout=picmi.GriddedLayout(n_macroparticle_per_cell=[1, 1], grid=grid)
+)
+sim.add_diagnostic(callback_timing)
+
+sim.initialize_inputs()
+sim.initialize_warpx()
+
+##########################
+# callbacks
+##########################
+
+beforestep_steps = []
+afterstep_steps = []
+
+
+def beforestep():
+    beforestep_steps.append(libwarpx.libwarpx_so.get_instance().getistep(0))
+
+
+def afterstep():
+    afterstep_steps.append(libwarpx.libwarpx_so.get_instance().getistep(0))
+
+
+callbacks.installbeforestep(beforestep)
+callbacks.installcallback("afterstep", afterstep, intervals="5")
+
+##########################
+# simulation run
+##########################
+
+sim.step(max_steps)
+
+# the afterstep callback only runs at the steps in its intervals, the
+# beforestep callback at every step
+assert beforestep_steps == list(range(max_steps))
+assert afterstep_steps == [5, 10, 15, 20]
+
+beforestep_stats = callbacks.get_callback_stats("beforestep")
+assert beforestep_stats["ncalls"] == max_steps
+assert beforestep_stats["nskipped"] == 0
+
+afterstep_stats = callbacks.get_callback_stats("afterstep")
+assert afterstep_stats["ncalls"] == 4
+assert afterstep_stats["nskipped"] == max_steps - 4
+assert 0.0 < afterstep_stats["max_time"] <= afterstep_stats["total_time"]
+
+# without intervals, the callback runs again at every step
+callbacks.set_callback_intervals("afterstep", "")
+sim.step(2)
+assert afterstep_steps[-2:] == [max_steps + 1, max_steps + 2]
+afterstep_stats = callbacks.get_callback_stats("afterstep")
+assert afterstep_stats["ncalls"] == 6
+assert afterstep_stats["nskipped"] == max_steps - 4
+
+# a location without installed functions is neither called nor skipped
+assert callbacks.get_callback_stats("afterEpush")["ncalls"] == 0
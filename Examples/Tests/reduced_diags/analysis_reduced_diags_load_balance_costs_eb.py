@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+
+# This script tests the reduced diagnostics `LoadBalanceCosts` with the
+# `Heuristic` costs update weighted by the fraction of each box that is outside
+# of the embedded boundary (algo.costs_heuristic_eb_weighting).
+# The upper quarter of the domain (z > 3) is covered by the embedded boundary
+# and the plasma only fills z < 1, so that the boxes with 2 < z < 3 and the
+# boxes with 3 < z < 4 both have no particles: the cost of the covered boxes
+# should be much smaller than the cost of the uncovered ones.
+
+import numpy as np
+
+# Load costs data
+data = np.genfromtxt("./diags/reducedfiles/LBC.txt")
+data = data[:, 2:]
+
+# Compute the number of datafields saved per box
+with open("./diags/reducedfiles/LBC.txt") as f:
+    h = f.readlines()[0]
+unique_headers = ["".join([ln for ln in w if not ln.isdigit()]) for w in h.split()][
+    2::
+]
+n_data_fields = len(set(unique_headers))
+
+# From data header, data layout is:
+#     [step, time,
+#      cost_box_0, proc_box_0, lev_box_0, i_low_box_0, j_low_box_0, k_low_box_0(, gpu_ID_box_0 if GPU run), hostname_box_0,
+#      ...]
+n_cell_z = 128
+max_grid_size = 32
+for i in range(data.shape[0]):
+    costs = data[i, 0::n_data_fields]
+    k_low = data[i, 5::n_data_fields].astype(int)
+    # boxes with 3 < z < 4 (covered) and with 2 < z < 3 (empty, uncovered)
+    covered = costs[k_low == n_cell_z - max_grid_size]
+    uncovered = costs[k_low == n_cell_z - 2 * max_grid_size]
+    print(f"step {i}: covered box costs {covered}, uncovered box costs {uncovered}")
+    assert covered.size > 0 and uncovered.size > 0
+    assert np.all(covered < 0.1 * uncovered.min())
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+
+import argparse
+import os
+
+import numpy as np
+import yt
+
+yt.funcs.mylog.setLevel(50)
+
+
+def compare_runs(path, reference, fields=None, rtol=1e-12):
+    """
+    Compare the fields of a plotfile with those of the same plotfile
+    written by a reference run of the test.
+
+    Parameters
+    ----------
+    path : str
+        Path to the plotfile of the current run.
+    reference : str
+        Path to the directory of the reference run, in which the plotfile is
+        found at the same relative path.
+    fields : list of str, optional
+        Names of the fields to compare (all mesh fields if None).
+    rtol : float, optional
+        Tolerance on the maximum difference, relative to the maximum absolute
+        value of each field in the reference run. The fields that vanish in
+        the reference run are skipped.
+    """
+    ds = yt.load(path)
+    ds_ref = yt.load(os.path.join(reference, path))
+    if fields is None:
+        fields = [name for ftype, name in ds_ref.field_list if ftype == "boxlib"]
+
+    ad = ds.covering_grid(
+        level=0, left_edge=ds.domain_left_edge, dims=ds.domain_dimensions
+    )
+    ad_ref = ds_ref.covering_grid(
+        level=0, left_edge=ds_ref.domain_left_edge, dims=ds_ref.domain_dimensions
+    )
+
+    for field in fields:
+        F = ad[("mesh", field)].v
+        F_ref = ad_ref[("mesh", field)].v
+        error = np.max(np.abs(F - F_ref))
+        scale = np.max(np.abs(F_ref))
+        if scale == 0.0:
+            print(f"{field}: vanishes in the reference run, skipped")
+            continue
+        print(f"{field}: max error = {error}, max |{field}| = {scale}")
+        assert error <= rtol * scale, f"{field} differs from the reference run"
+
+
+def get_parser(description=None, reference_required=True):
+    """
+    Return the command-line parser of compare_runs, to which analysis
+    scripts can add the arguments of their own checks. Scripts for which the
+    comparison is optional can make --reference optional.
+    """
+    parser = argparse.ArgumentParser(description=description)
+    parser.add_argument("--path", help="path to the plotfile", type=str, required=True)
+    parser.add_argument(
+        "--reference",
+        help="path to the directory of the reference run",
+        type=str,
+        required=reference_required,
+    )
+    parser.add_argument(
+        "--rtol",
+        help="relative tolerance on the field differences",
+        type=float,
+        default=1e-12,
+    )
+    parser.add_argument(
+        "--fields",
+        help="fields to compare (default: all mesh fields)",
+        type=str,
+        nargs="+",
+        default=None,
+    )
+    return parser
+
+
+if __name__ == "__main__":
+    args = get_parser(description=compare_runs.__doc__).parse_args()
+    compare_runs(args.path, args.reference, args.fields, args.rtol)
@@ -76,6 +76,25 @@ The above example is quivalent to the following:
 
    # run simulation
    sim.step(nsteps=100)
+
+Callbacks that only need to run at some steps can be given step intervals, with
+the same syntax as the diagnostics ``intervals``. The intervals apply to all
+functions installed at that location and are checked in C++ before entering
+Python, so that the steps in between have no Python overhead. They are compared
+with the current step number, i.e. the number of completed steps, so that for
+``afterstep`` the numbering is the same as for the diagnostics.
+
+.. code-block:: python3
+
+   installcallback('afterstep', myplots, intervals='100')
+
+   # equivalently, for all functions installed at 'afterstep'
+   set_callback_intervals('afterstep', '100')
+
+The number of calls and skipped calls and the total and maximum time spent in
+each callback location are accumulated in C++, and can be queried with
+:py:func:`get_callback_stats` or written with the ``PythonCallbackTiming``
+reduced diagnostic.
 """
 
 import copy
@@ -310,12 +329,32 @@ for key, val in callback_instances.items():
     callback_instances[key] = CallbackFunctions(name=key, **val)
 
 
-def installcallback(name, f):
+def installcallback(name, f, intervals=None):
     """Installs a function to be called at that specified time.
 
     Adds a function to the list of functions called by this callback.
+    If intervals is given, the callback (i.e. all functions installed at that
+    location) is only called at the steps matching the intervals string.
     """
     callback_instances[name].installfuncinlist(f)
+    if intervals is not None:
+        set_callback_intervals(name, intervals)
+
+
+def set_callback_intervals(name, intervals):
+    """Only call the functions of this callback at the steps matching the
+    intervals string (e.g. "100" or "0:1000:10,2000:"). The check is done
+    without entering Python. An empty string removes the restriction."""
+    if name not in callback_instances:
+        raise KeyError(f"Unknown callback location {name}")
+    libwarpx.libwarpx_so.set_python_callback_intervals(name, intervals)
+
+
+def get_callback_stats(name):
+    """Returns the timing statistics of this callback on this process, as a dict
+    with the number of calls and skipped calls and the total and maximum time
+    of a call (in seconds)."""
+    return libwarpx.libwarpx_so.get_python_callback_stats(name)
 
 
 def uninstallcallback(name, f):
@@ -6,6 +6,8 @@ Authors: Axel Huebl, David Grote
 License: BSD-3-Clause-LBNL
 """
 
+from .ViewsCache import ViewsCache, zero_copy_view
+
 
 def mesh(self, direction, include_ghosts=False):
     """Returns the mesh along the specified direction with the appropriate centering.
@@ -45,6 +47,40 @@ def mesh(self, direction, include_ghosts=False):
     return lo + imesh * dd
 
 
+# Cached FAB views, released with their MultiFab
+_fab_views_cache = ViewsCache()
+
+
+def fab_views(self):
+    """Returns a list with the numpy or cupy arrays of the local FABs (including ghost cells).
+
+    The arrays are not copied, but share the underlying memory buffer with
+    WarpX, and are fully writeable. The views are cached and only rebuilt
+    when the FABs are reallocated (e.g., after regrid or load balancing).
+    """
+    from .._libwarpx import libwarpx
+    from ..LoadThirdParty import load_cupy
+
+    layout = libwarpx.libwarpx_so.multifab_data_layout(self)
+    views = _fab_views_cache.get(self, None, layout)
+    if views is not None:
+        return views
+
+    xp, cupy_status = load_cupy()
+    if cupy_status is not None:
+        libwarpx.amr.Print(cupy_status)
+
+    views = [zero_copy_view(xp, self.array(mfi)) for mfi in self]
+
+    _fab_views_cache.set(self, None, layout, views)
+    return views
+
+
+def iterate_tiles(self):
+    """Iterates over the local FABs, yielding zero-copy numpy or cupy arrays. See ``fab_views``."""
+    yield from self.fab_views()
+
+
 def register_warpx_MultiFab_extension(amr):
     """MultiFab helper methods"""
 
@@ -53,3 +89,5 @@ def register_warpx_MultiFab_extension(amr):
 
     # register member functions for the MultiFab type
     amr.MultiFab.mesh = mesh
+    amr.MultiFab.fab_views = fab_views
+    amr.MultiFab.iterate_tiles = iterate_tiles
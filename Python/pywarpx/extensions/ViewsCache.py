@@ -0,0 +1,76 @@
+"""
+This file is part of WarpX
+
+Copyright 2024 WarpX community
+License: BSD-3-Clause-LBNL
+"""
+
+import weakref
+
+
+class _ArrayInterface(object):
+    """Holds the array interface of a pyAMReX object, without referencing it."""
+
+    def __init__(self, obj, cuda):
+        if cuda:
+            self.__cuda_array_interface__ = obj.__cuda_array_interface__
+        else:
+            self.__array_interface__ = obj.__array_interface__
+
+
+def zero_copy_view(xp, obj):
+    """Returns a numpy or cupy array sharing the memory of the pyAMReX object obj.
+
+    Unlike ``xp.array(obj, copy=False)``, the array does not keep obj (and the
+    objects obj keeps alive, like its MultiFab or particle tile) alive, so that
+    cached views do not prevent these from being freed. The views must not be
+    used after the memory is reallocated; ViewsCache checks this with the data
+    layout.
+    """
+    return xp.array(_ArrayInterface(obj, xp.__name__ == "cupy"), copy=False)
+
+
+class ViewsCache(object):
+    """Cache of zero-copy views of the data of pyAMReX objects.
+
+    The entries are stored per object and per key (e.g., the mesh refinement
+    level), together with the data layout they were built for. The cache only
+    holds weak references to the objects: the entries of an object are
+    removed when it is garbage collected.
+    """
+
+    def __init__(self):
+        # id(object) -> (weak reference to object, {key: (layout, views)})
+        self._entries = {}
+
+    def __len__(self):
+        return len(self._entries)
+
+    def __contains__(self, obj):
+        entry = self._entries.get(id(obj))
+        return entry is not None and entry[0]() is obj
+
+    def get(self, obj, key, layout):
+        """Returns the cached views of obj for key, or None if there are none
+        or if they were built for a different data layout."""
+        entry = self._entries.get(id(obj))
+        if entry is None or entry[0]() is not obj:
+            return None
+        cached = entry[1].get(key)
+        if cached is None or cached[0] != layout:
+            return None
+        return cached[1]
+
+    def set(self, obj, key, layout, views):
+        """Caches the views of obj for key, built for the given data layout."""
+        entry = self._entries.get(id(obj))
+        if entry is None or entry[0]() is not obj:
+            entry = (weakref.ref(obj), {})
+            self._entries[id(obj)] = entry
+            weakref.finalize(obj, self._discard, id(obj), entry[0])
+        entry[1][key] = (layout, views)
+
+    def _discard(self, obj_id, ref):
+        entry = self._entries.get(obj_id)
+        if entry is not None and entry[0] is ref:
+            del self._entries[obj_id]
@@ -6,6 +6,8 @@ Authors: Axel Huebl, David Grote
 License: BSD-3-Clause-LBNL
 """
 
+from .ViewsCache import ViewsCache, zero_copy_view
+
 
 def add_particles(
     self,
@@ -171,6 +173,79 @@ def add_particles(
     )
 
 
+# Cached tile views per level, released with their particle container
+_tile_views_cache = ViewsCache()
+
+
+def tile_views(self, level=0):
+    """
+    Returns a list with, for each particle tile on this process, a dict
+    mapping the component names to numpy or cupy arrays.
+
+    The dict contains the real and int components (by name) and the
+    ``"idcpu"`` array. The arrays are not copied, but share the underlying
+    memory buffer with WarpX, and are fully writeable.
+
+    The views are cached, so that repeated calls (e.g., from callbacks at
+    every step) do not recreate them. They are rebuilt only when the local
+    particle data layout changes, i.e., when particle arrays are reallocated
+    or resized (Redistribute, regrid, load balancing, injection, ...).
+
+    Parameters
+    ----------
+
+    level : int
+        The refinement level to reference (default=0)
+
+    Returns
+    -------
+
+    List of dicts of arrays, one per tile
+    """
+    from .._libwarpx import libwarpx
+    from ..LoadThirdParty import load_cupy
+
+    layout = self.data_layout(level)
+    views = _tile_views_cache.get(self, level, layout)
+    if views is not None:
+        return views
+
+    xp, cupy_status = load_cupy()
+    if cupy_status is not None:
+        libwarpx.amr.Print(cupy_status)
+
+    real_names = self.real_soa_names
+    int_names = self.int_soa_names
+
+    views = []
+    for pti in libwarpx.libwarpx_so.WarpXParIter(self, level):
+        soa = pti.soa()
+        tile = {"idcpu": zero_copy_view(xp, soa.get_idcpu_data())}
+        for idx, name in enumerate(real_names):
+            tile[name] = zero_copy_view(xp, soa.get_real_data(idx))
+        for idx, name in enumerate(int_names):
+            tile[name] = zero_copy_view(xp, soa.get_int_data(idx))
+        views.append(tile)
+
+    _tile_views_cache.set(self, level, layout, views)
+    return views
+
+
+def iterate_tiles(self, level=0):
+    """
+    Iterates over the particle tiles on this process, yielding for each
+    tile a dict mapping the component names to zero-copy numpy or cupy
+    arrays. See ``tile_views``.
+
+    Parameters
+    ----------
+
+    level : int
+        The refinement level to reference (default=0)
+    """
+    yield from self.tile_views(level)
+
+
 def register_warpx_WarpXParticleContainer_extension(libwarpx_so):
     """WarpXParticleContainer helper methods"""
 
@@ -178,3 +253,5 @@ def register_warpx_WarpXParticleContainer_extension(libwarpx_so):
     #   note: this currently overwrites the pyAMReX signature
     #         add_particles(other: ParticleContainer, local: bool = False)
     libwarpx_so.WarpXParticleContainer.add_particles = add_particles
+    libwarpx_so.WarpXParticleContainer.tile_views = tile_views
+    libwarpx_so.WarpXParticleContainer.iterate_tiles = iterate_tiles
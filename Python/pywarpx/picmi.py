@@ -2208,6 +2208,29 @@ class HybridPICSolver(picmistandard.base._ClassWithInit):
         half-step before the simulation aborts. Only used when
         ``use_rkf45`` is active.
 
+    adaptive_substeps: bool, default=False
+        If True, use the RKF45 error controller at every timestep and carry
+        the substep size it selects over to the next half-step, separately
+        on each refinement level, within ``min_substeps`` and
+        ``max_substeps``.
+
+    min_substeps: int, default=2
+        Minimum number of substeps per timestep. Only used when
+        ``adaptive_substeps`` is True.
+
+    max_substeps: int, default=max_substep_attempts
+        Maximum number of substeps per timestep. Only used when
+        ``adaptive_substeps`` is True.
+
+    substep_min_factor: float, default=0.1
+        Smallest factor by which the substep size may shrink after a rejected
+        step. Only used when ``use_rkf45`` is active.
+
+    fuse_substep_kernels: bool, default=False
+        If True, compute the plasma current and the E-field in a single pass
+        over the tiles at each B-field substep. Only supported in Cartesian
+        geometries.
+
     holmstrom_vacuum_region: bool, default=False
         Flag to determine handling of vacuum region (where rho < n_floor*q_e). Setting to True will solve the simplified Generalized Ohm's Law dropping the Hall and pressure terms in the vacuum region. See `Holmstrom (2013) <https://arxiv.org/abs/1301.0272v1>`_.
         This flag is useful for suppressing vacuum region fluctuations. A large resistivity value must be used when rho <= rho_floor.
@@ -2270,6 +2293,11 @@ class HybridPICSolver(picmistandard.base._ClassWithInit):
         substep_safety=None,
         substep_max_growth=None,
         max_substep_attempts=None,
+        adaptive_substeps=None,
+        min_substeps=None,
+        max_substeps=None,
+        substep_min_factor=None,
+        fuse_substep_kernels=None,
         holmstrom_vacuum_region=None,
         Jx_external_function=None,
         Jy_external_function=None,
@@ -2300,6 +2328,11 @@ class HybridPICSolver(picmistandard.base._ClassWithInit):
         self.substep_safety = substep_safety
         self.substep_max_growth = substep_max_growth
         self.max_substep_attempts = max_substep_attempts
+        self.adaptive_substeps = adaptive_substeps
+        self.min_substeps = min_substeps
+        self.max_substeps = max_substeps
+        self.substep_min_factor = substep_min_factor
+        self.fuse_substep_kernels = fuse_substep_kernels
 
         self.holmstrom_vacuum_region = holmstrom_vacuum_region
 
@@ -2372,6 +2405,11 @@ class HybridPICSolver(picmistandard.base._ClassWithInit):
         pywarpx.hybridpicmodel.substep_safety = self.substep_safety
         pywarpx.hybridpicmodel.substep_max_growth = self.substep_max_growth
         pywarpx.hybridpicmodel.max_substep_attempts = self.max_substep_attempts
+        pywarpx.hybridpicmodel.adaptive_substeps = self.adaptive_substeps
+        pywarpx.hybridpicmodel.min_substeps = self.min_substeps
+        pywarpx.hybridpicmodel.max_substeps = self.max_substeps
+        pywarpx.hybridpicmodel.substep_min_factor = self.substep_min_factor
+        pywarpx.hybridpicmodel.fuse_substep_kernels = self.fuse_substep_kernels
         pywarpx.hybridpicmodel.holmstrom_vacuum_region = self.holmstrom_vacuum_region
         pywarpx.hybridpicmodel.__setattr__(
             "Jx_external_grid_function(x,y,z,t)",
@@ -5176,6 +5214,9 @@ class ReducedDiagnostic(picmistandard.base._ClassWithInit, WarpXDiagnosticBase):
     weighting_function: string, optional
         For diagnostic type 'ChargeOnEB', the function to weight contributions to the total charge
 
+    callback_names: list of strings, optional
+        For diagnostic type 'PythonCallbackTiming', the callback locations that are reported
+
     reduction_type: {'Maximum', 'Minimum', or 'Integral'}
         For diagnostic type 'FieldReduction', the type of reduction
 
@@ -5246,6 +5287,7 @@ class ReducedDiagnostic(picmistandard.base._ClassWithInit, WarpXDiagnosticBase):
             "LoadBalanceCosts",
             "LoadBalanceEfficiency",
             "Timestep",
+            "HybridPICSubsteps",
         ]
         # The species diagnostics require a species to be provided
         self._species_reduced_diagnostics = [
@@ -5270,6 +5312,8 @@ class ReducedDiagnostic(picmistandard.base._ClassWithInit, WarpXDiagnosticBase):
             kw = self._handle_field_reduction(**kw)
         elif self.type == "ChargeOnEB":
             kw = self._handle_charge_on_eb(**kw)
+        elif self.type == "PythonCallbackTiming":
+            self.callback_names = kw.pop("callback_names", None)
         else:
             raise RuntimeError(
                 f"{self.type} reduced diagnostic is not yet supported in pywarpx."
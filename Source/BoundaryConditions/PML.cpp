@@ -1135,6 +1135,67 @@ void PML::Exchange (amrex::MultiFab* mf_pml,
     if (mf_pml && mf) { Exchange(*mf_pml, *mf, geom, do_pml_in_domain); }
 }
 
+bool
+PML::ExchangeLayout::matches (const MultiFab& pml, const MultiFab& reg,
+                               const amrex::Periodicity& a_period) const
+{
+    return reg_ba == reg.boxArray() && reg_dm == reg.DistributionMap() &&
+        reg_ngrow == reg.nGrowVect() &&
+        pml_ba == pml.boxArray() && pml_dm == pml.DistributionMap() &&
+        pml_ncomp == pml.nComp() && pml_ngrow == pml.nGrowVect() &&
+        period == a_period;
+}
+
+PML::ExchangeLayout const&
+PML::GetExchangeLayout (const MultiFab& pml, const MultiFab& reg, const Geometry& geom)
+{
+    const auto& period = geom.periodicity();
+    for (auto const& layout : m_exchange_layouts) {
+        if (layout.matches(pml, reg, period)) { return layout; }
+    }
+
+    // Layouts of (at most) E, B, F and G, for the fine and coarse patches;
+    // more entries means that the grids have changed
+    constexpr int max_layouts = 16;
+    if (static_cast<int>(m_exchange_layouts.size()) >= max_layouts) { m_exchange_layouts.clear(); }
+
+    ExchangeLayout layout;
+    layout.reg_ba = reg.boxArray();
+    layout.reg_dm = reg.DistributionMap();
+    layout.reg_ngrow = reg.nGrowVect();
+    layout.pml_ba = pml.boxArray();
+    layout.pml_dm = pml.DistributionMap();
+    layout.pml_ncomp = pml.nComp();
+    layout.pml_ngrow = pml.nGrowVect();
+    layout.period = period;
+
+    // Select the boxes of the regular grid whose guard cells overlap the PML
+    // valid cells, or whose valid cells overlap the PML guard cells
+    const IntVect ng = amrex::max(reg.nGrowVect(), pml.nGrowVect());
+    const std::vector<IntVect>& shifts = period.shiftIntVect();
+    BoxList bl(reg.boxArray().ixType());
+    Vector<int> pmap;
+    for (int i = 0; i < static_cast<int>(reg.boxArray().size()); ++i) {
+        const Box& gbx = amrex::grow(reg.boxArray()[i], ng);
+        bool overlaps = pml.boxArray().intersects(gbx);
+        for (const auto& iv : shifts) {
+            if (overlaps) { break; }
+            overlaps = pml.boxArray().intersects(gbx + iv);
+        }
+        if (overlaps) {
+            bl.push_back(reg.boxArray()[i]);
+            pmap.push_back(reg.DistributionMap()[i]);
+            layout.reg_index.push_back(i);
+        }
+    }
+
+    layout.tmpreg_ba = BoxArray(std::move(bl));
+    layout.tmpreg_dm = DistributionMapping(std::move(pmap));
+
+    m_exchange_layouts.push_back(std::move(layout));
+    return m_exchange_layouts.back();
+}
+
 void
 PML::Exchange (MultiFab& pml, MultiFab& reg, const Geometry& geom,
                 int do_pml_in_domain)
@@ -1146,12 +1207,16 @@ PML::Exchange (MultiFab& pml, MultiFab& reg, const Geometry& geom,
     const int ncp = pml.nComp();
     const auto& period = geom.periodicity();
 
-    // Create temporary MultiFab to copy to and from the PML
-    MultiFab tmpregmf(reg.boxArray(), reg.DistributionMap(), ncp, ngr);
+    // Temporary MultiFabs to copy to and from the PML. The copy of the regular
+    // grid only covers the boxes that overlap the PML; its box `mfi.index()`
+    // is the box `reg_index[mfi.index()]` of the regular grid, on the same rank.
+    ExchangeLayout const& layout = GetExchangeLayout(pml, reg, geom);
+    MultiFab tmpregmf(layout.tmpreg_ba, layout.tmpreg_dm, ncp, ngr);
+    MultiFab totpmlmf(pml.boxArray(), pml.DistributionMap(), 1, 0);
+    const Vector<int>& reg_index = layout.reg_index;
     tmpregmf.setVal(0.0);
 
     // Create the sum of the split fields, in the PML
-    MultiFab totpmlmf(pml.boxArray(), pml.DistributionMap(), 1, 0); // Allocate
     MultiFab::LinComb(totpmlmf, 1.0, pml, 0, 1.0, pml, 1, 0, 1, 0); // Sum
     if (ncp == 3) {
         MultiFab::Add(totpmlmf,pml,2,0,1,0); // Sum the third split component
@@ -1170,17 +1235,29 @@ PML::Exchange (MultiFab& pml, MultiFab& reg, const Geometry& geom,
         // Copy from valid cells of PML to ghost cells of regular grid
         // but avoid updating the outermost valid cell
         if (ngr.max() > 0) {
-            MultiFab::Copy(tmpregmf, reg, 0, 0, 1, ngr);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+            for (MFIter mfi(tmpregmf); mfi.isValid(); ++mfi)
+            {
+                const auto srcarr = reg[reg_index[mfi.index()]].const_array();
+                auto dstarr = tmpregmf[mfi].array();
+                amrex::ParallelFor(mfi.fabbox(),
+                                   [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                                   {
+                                       dstarr(i,j,k,0) = srcarr(i,j,k,0);
+                                   });
+            }
             ablastr::utils::communication::ParallelCopy(tmpregmf, totpmlmf, 0, 0, 1, IntVect(0), ngr,
                                    WarpX::do_single_precision_comms,
                                                         period);
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-            for (MFIter mfi(reg); mfi.isValid(); ++mfi)
+            for (MFIter mfi(tmpregmf); mfi.isValid(); ++mfi)
             {
                 const FArrayBox& src = tmpregmf[mfi];
-                FArrayBox& dst = reg[mfi];
+                FArrayBox& dst = reg[reg_index[mfi.index()]];
                 const auto srcarr = src.array();
                 auto dstarr = dst.array();
                 const BoxList& bl = amrex::boxDiff(dst.box(), mfi.validbox());
@@ -1200,7 +1277,19 @@ PML::Exchange (MultiFab& pml, MultiFab& reg, const Geometry& geom,
     // (and outermost valid cell in the nodal direction)
     // More specifically, copy from regular data to PML's first component
     // Zero out the second (and third) component
-    MultiFab::Copy(tmpregmf,reg,0,0,1,0); // Fill first component of tmpregmf
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(tmpregmf); mfi.isValid(); ++mfi)
+    {
+        const auto srcarr = reg[reg_index[mfi.index()]].const_array();
+        auto dstarr = tmpregmf[mfi].array();
+        amrex::ParallelFor(mfi.validbox(),
+                           [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                           {
+                               dstarr(i,j,k,0) = srcarr(i,j,k,0); // Fill first component of tmpregmf
+                           });
+    }
     tmpregmf.setVal(0.0, 1, ncp-1, 0); // Zero out the second (and third) component
     if (do_pml_in_domain){
         // Where valid cells of tmpregmf overlap with PML valid cells,
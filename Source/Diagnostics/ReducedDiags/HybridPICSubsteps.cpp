@@ -0,0 +1,83 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "HybridPICSubsteps.H"
+
+#include "FieldSolver/FiniteDifferenceSolver/HybridPICModel/HybridPICModel.H"
+#include "Utils/TextMsg.H"
+#include "WarpX.H"
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_REAL.H>
+
+#include <fstream>
+
+using namespace amrex::literals;
+
+// constructor
+HybridPICSubsteps::HybridPICSubsteps (const std::string& rd_name)
+:ReducedDiags{rd_name}
+{
+    const auto& warpx = WarpX::GetInstance();
+    const auto max_level = warpx.maxLevel();
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        warpx.get_pointer_HybridPICModel() != nullptr,
+        "HybridPICSubsteps reduced diagnostics requires algo.maxwell_solver = hybrid");
+
+    // data size: m_nvars quantities per refinement level
+    m_data.resize(m_nvars*(max_level + 1), 0.0_rt);
+
+    if (amrex::ParallelDescriptor::IOProcessor() && m_write_header) {
+        // open file
+        std::ofstream ofs{m_path + m_rd_name + "." + m_extension, std::ofstream::out};
+
+        // write header row
+        int c = 0;
+        ofs << "#";
+        ofs << "[" << c++ << "]step()";
+        ofs << m_sep;
+        ofs << "[" << c++ << "]time(s)";
+
+        for (int lev = 0; lev <= max_level; lev++) {
+            ofs << m_sep;
+            ofs << "[" << c++ << "]accepted_substeps_lev" << lev << "()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]rejected_substeps_lev" << lev << "()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]next_substeps_lev" << lev << "()";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]dt_sub_min_lev" << lev << "(s)";
+            ofs << m_sep;
+            ofs << "[" << c++ << "]dt_sub_max_lev" << lev << "(s)";
+        }
+
+        // close file
+        ofs << "\n";
+        ofs.close();
+    }
+}
+// end constructor
+
+// function to get the substepping statistics at all refinement levels
+void HybridPICSubsteps::ComputeDiags (int step) {
+    // Check if diagnostic should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    auto& warpx = WarpX::GetInstance();
+    auto* hybrid_pic_model = warpx.get_pointer_HybridPICModel();
+
+    for (int lev = 0; lev <= warpx.finestLevel(); lev++) {
+        auto const& stats = hybrid_pic_model->GetSubstepStatistics(lev);
+        m_data[m_nvars*lev + 0] = static_cast<amrex::Real>(stats.n_accepted);
+        m_data[m_nvars*lev + 1] = static_cast<amrex::Real>(stats.n_rejected);
+        m_data[m_nvars*lev + 2] = static_cast<amrex::Real>(hybrid_pic_model->GetSubsteps(lev));
+        m_data[m_nvars*lev + 3] = stats.dt_sub_min;
+        m_data[m_nvars*lev + 4] = stats.dt_sub_max;
+    }
+}
+// end HybridPICSubsteps::ComputeDiags
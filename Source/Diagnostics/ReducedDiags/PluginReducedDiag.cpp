@@ -0,0 +1,63 @@
+/* Copyright 2026 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "PluginReducedDiag.H"
+
+#include "Utils/Plugins/WarpXPlugins.H"
+#include "Utils/TextMsg.H"
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_REAL.H>
+
+#include <fstream>
+
+using namespace amrex::literals;
+
+// constructor
+PluginReducedDiag::PluginReducedDiag (const std::string& rd_name)
+:ReducedDiags{rd_name}
+{
+    const amrex::ParmParse pp_rd_name(rd_name);
+    pp_rd_name.get("plugin_name", m_plugin_name);
+
+    auto const& plugin = warpx::plugins::GetPluginRegistry().getReducedDiag(m_plugin_name);
+    m_data.resize(plugin.column_names.size(), 0.0_rt);
+
+    if (amrex::ParallelDescriptor::IOProcessor() && m_write_header) {
+        // open file
+        std::ofstream ofs{m_path + m_rd_name + "." + m_extension, std::ofstream::out};
+
+        // write header row
+        int c = 0;
+        ofs << "#";
+        ofs << "[" << c++ << "]step()";
+        ofs << m_sep;
+        ofs << "[" << c++ << "]time(s)";
+        for (const auto& column : plugin.column_names) {
+            ofs << m_sep << "[" << c++ << "]" << column;
+        }
+
+        // close file
+        ofs << "\n";
+        ofs.close();
+    }
+}
+// end constructor
+
+void PluginReducedDiag::ComputeDiags (int step)
+{
+    // Check if diagnostic should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    auto const& plugin = warpx::plugins::GetPluginRegistry().getReducedDiag(m_plugin_name);
+    plugin.compute(step, m_data);
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_data.size() == plugin.column_names.size(),
+        "The plugin reduced diagnostic '" + m_plugin_name + "' changed its number of values");
+}
+// end PluginReducedDiag::ComputeDiags
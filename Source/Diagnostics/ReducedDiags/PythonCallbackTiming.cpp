@@ -0,0 +1,81 @@
+/* Copyright 2026 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+
+#include "PythonCallbackTiming.H"
+
+#include "Python/callbacks.H"
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_REAL.H>
+
+#include <fstream>
+
+using namespace amrex::literals;
+
+namespace
+{
+    /// number of values written per callback location
+    constexpr int n_values = 4;
+}
+
+// constructor
+PythonCallbackTiming::PythonCallbackTiming (const std::string& rd_name)
+:ReducedDiags{rd_name}
+{
+    // by default, report the callbacks of the time step loop
+    m_callback_names = {"beforestep", "particleinjection", "beforecollisions", "aftercollisions",
+                        "beforeEsolve", "afterEsolve", "afterBpush", "afterEpush",
+                        "beforedeposition", "afterdeposition", "particlescraper",
+                        "afterstep", "afterdiagnostics"};
+    const amrex::ParmParse pp_rd_name(rd_name);
+    pp_rd_name.queryarr("callback_names", m_callback_names);
+
+    m_data.resize(n_values*m_callback_names.size(), 0.0_rt);
+
+    if (amrex::ParallelDescriptor::IOProcessor() && m_write_header) {
+        // open file
+        std::ofstream ofs{m_path + m_rd_name + "." + m_extension, std::ofstream::out};
+
+        // write header row
+        int c = 0;
+        ofs << "#";
+        ofs << "[" << c++ << "]step()";
+        ofs << m_sep;
+        ofs << "[" << c++ << "]time(s)";
+        for (const auto& name : m_callback_names) {
+            ofs << m_sep << "[" << c++ << "]" << name << "_ncalls()";
+            ofs << m_sep << "[" << c++ << "]" << name << "_nskipped()";
+            ofs << m_sep << "[" << c++ << "]" << name << "_total_time(s)";
+            ofs << m_sep << "[" << c++ << "]" << name << "_max_time(s)";
+        }
+
+        // close file
+        ofs << "\n";
+        ofs.close();
+    }
+}
+// end constructor
+
+void PythonCallbackTiming::ComputeDiags (int step)
+{
+    // Check if diagnostic should be done
+    if (!m_intervals.contains(step+1)) { return; }
+
+    for (std::size_t i = 0; i < m_callback_names.size(); ++i) {
+        auto const stats = GetPythonCallbackStats(m_callback_names[i]);
+        m_data[n_values*i  ] = static_cast<amrex::Real>(stats.ncalls);
+        m_data[n_values*i+1] = static_cast<amrex::Real>(stats.nskipped);
+        m_data[n_values*i+2] = static_cast<amrex::Real>(stats.total_time);
+        m_data[n_values*i+3] = static_cast<amrex::Real>(stats.max_time);
+    }
+
+    // the slowest rank determines the cost of the callbacks
+    amrex::ParallelDescriptor::ReduceRealMax(m_data.data(), static_cast<int>(m_data.size()),
+        amrex::ParallelDescriptor::IOProcessorNumber());
+}
+// end PythonCallbackTiming::ComputeDiags
@@ -28,6 +28,7 @@
 #include <AMReX_Math.H>
 #include <AMReX_MFIter.H>
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_Reduce.H>
 
 namespace web = warpx::embedded_boundary;
 
@@ -622,4 +623,80 @@ web::ScaleAreas (
     }
 }
 
+std::unique_ptr<amrex::LayoutData<web::EBBoxType>>
+web::ClassifyBoxes (const amrex::MultiFab& distance_to_eb)
+{
+    BL_PROFILE("ClassifyBoxes");
+    using namespace amrex::literals;
+
+    auto box_type = std::make_unique<amrex::LayoutData<EBBoxType>>(
+        distance_to_eb.boxArray(), distance_to_eb.DistributionMap());
+
+    // Not tiled: the classification is per box, including the guard nodes
+    // that are read when interpolating the distance at the particle positions
+    for (amrex::MFIter mfi(distance_to_eb); mfi.isValid(); ++mfi) {
+        amrex::Array4<amrex::Real const> const& dist = distance_to_eb.const_array(mfi);
+
+        amrex::ReduceOps<amrex::ReduceOpMin, amrex::ReduceOpMax> reduce_op;
+        amrex::ReduceData<amrex::Real, amrex::Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+        reduce_op.eval(mfi.fabbox(), reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                return {dist(i,j,k), dist(i,j,k)};
+            });
+        auto const hv = reduce_data.value(reduce_op);
+        amrex::Real const dist_min = amrex::get<0>(hv);
+        amrex::Real const dist_max = amrex::get<1>(hv);
+
+        if (dist_min >= 0.0_rt) {
+            (*box_type)[mfi] = EBBoxType::Regular;
+        } else if (dist_max < 0.0_rt) {
+            (*box_type)[mfi] = EBBoxType::Covered;
+        } else {
+            (*box_type)[mfi] = EBBoxType::Cut;
+        }
+    }
+
+    return box_type;
+}
+
+std::unique_ptr<amrex::LayoutData<int>>
+web::FindBoxesWithoutUpdate (std::array< std::unique_ptr<amrex::iMultiFab>,3> const& eb_update)
+{
+    BL_PROFILE("FindBoxesWithoutUpdate");
+
+    auto no_update = std::make_unique<amrex::LayoutData<int>>(
+        eb_update[0]->boxArray(), eb_update[0]->DistributionMap());
+
+    for (amrex::MFIter mfi(*eb_update[0]); mfi.isValid(); ++mfi) {
+        amrex::Array4<int const> const& update_x = eb_update[0]->const_array(mfi);
+        amrex::Array4<int const> const& update_y = eb_update[1]->const_array(mfi);
+        amrex::Array4<int const> const& update_z = eb_update[2]->const_array(mfi);
+
+        amrex::ReduceOps<amrex::ReduceOpMax> reduce_op;
+        amrex::ReduceData<int> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+        reduce_op.eval(mfi.validbox(), reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                return {update_x(i,j,k)};
+            });
+        reduce_op.eval(eb_update[1]->box(mfi.index()), reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                return {update_y(i,j,k)};
+            });
+        reduce_op.eval(eb_update[2]->box(mfi.index()), reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+            {
+                return {update_z(i,j,k)};
+            });
+
+        (*no_update)[mfi] = (amrex::get<0>(reduce_data.value(reduce_op)) == 0) ? 1 : 0;
+    }
+
+    return no_update;
+}
+
 #endif
@@ -9,6 +9,7 @@
 
 #include "EmbeddedBoundary/Enabled.H"
 #ifdef AMREX_USE_EB
+#  include "EmbeddedBoundary/EmbeddedBoundaryInit.H"
 #  include "Fields.H"
 #  include "Utils/Parser/ParserUtils.H"
 #  include "Utils/TextMsg.H"
@@ -138,11 +139,13 @@ WarpX::ComputeDistanceToEB ()
 #ifdef AMREX_USE_EB
     BL_PROFILE("ComputeDistanceToEB");
     using warpx::fields::FieldType;
+    m_eb_box_type.resize(maxLevel()+1);
     for (int lev=0; lev<=maxLevel(); lev++) {
         auto const* eb_index_space = GetEBIndexSpace(lev);
         const amrex::EB2::Level& eb_level = eb_index_space->getLevel(Geom(lev));
         auto const eb_fact = fieldEBFactory(lev);
         amrex::FillSignedDistance(*m_fields.get(FieldType::distance_to_eb, lev), eb_level, eb_fact, 1);
+        m_eb_box_type[lev] = warpx::embedded_boundary::ClassifyBoxes(*m_fields.get(FieldType::distance_to_eb, lev));
     }
 #endif
 }
@@ -34,6 +34,7 @@
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "Utils/WarpXUtil.H"
 #include "Utils/WarpXConst.H"
+#include "Utils/Plugins/WarpXPlugins.H"
 
 #include <ablastr/profiler/ProfilerWrapper.H>
 #include <ablastr/utils/SignalHandling.H>
@@ -233,9 +234,19 @@ WarpX::Evolve (int numsteps)
         // perform particle injection
         ExecutePythonCallback("particleinjection");
 
+        // update the frozen boxes after all the particle injections of the step
+        if (m_freeze_empty_boxes) {
+            UpdateFrozenBoxes(step);
+        }
+
         // perform collisions and advance fields and particles by one time step
         OneStep(cur_time, dt[0], step);
 
+        // compiled user plugins, after the particle push and the field update of the step
+        auto const& plugins = warpx::plugins::GetPluginRegistry();
+        plugins.executeParticleHooks(*mypc, finest_level, cur_time + dt[0], dt[0]);
+        plugins.executeFieldHooks(m_fields, finest_level, cur_time + dt[0], dt[0]);
+
         // Resample particles
         // +1 is necessary here because value of step seen by user (first step is 1) is different than
         // value of step in code (first step is 0)
@@ -0,0 +1,188 @@
+/* Copyright 2026 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "WarpX.H"
+
+#include "EmbeddedBoundary/EBBoxType.H"
+#include "EmbeddedBoundary/Enabled.H"
+#include "Fields.H"
+#include "Particles/MultiParticleContainer.H"
+#include "Particles/WarpXParticleContainer.H"
+#include "Utils/TextMsg.H"
+
+#include <ablastr/fields/MultiFabRegister.H>
+#include <ablastr/profiler/ProfilerWrapper.H>
+
+#include <AMReX.H>
+#include <AMReX_BoxArray.H>
+#include <AMReX_BoxList.H>
+#include <AMReX_LayoutData.H>
+#include <AMReX_MFIter.H>
+#include <AMReX_MultiFab.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Periodicity.H>
+#include <AMReX_Print.H>
+#include <AMReX_REAL.H>
+#include <AMReX_Reduce.H>
+#include <AMReX_Vector.H>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace
+{
+    /** Reduction of the maximum of the fields over one box */
+    struct BoxReduction
+    {
+        amrex::ReduceOps<amrex::ReduceOpMax> op;
+        amrex::ReduceData<int> data{op};
+    };
+
+    /** Mark as active the local boxes in which any value of `fields`, in the valid region,
+     *  exceeds `threshold` in absolute value
+     *
+     * The reductions of all the fields and boxes are launched before any result is read,
+     * so that the host only waits once for the device.
+     */
+    void
+    markNonVanishingBoxes (amrex::Vector<amrex::MultiFab const*> const& fields,
+                           amrex::Real threshold, amrex::Vector<int>& active)
+    {
+        amrex::Vector<std::pair<int, std::unique_ptr<BoxReduction>>> reductions;
+        for (amrex::MFIter mfi(*fields[0]); mfi.isValid(); ++mfi) {
+            int const ibox = mfi.index();
+            if (active[ibox]) { continue; }
+            auto reduction = std::make_unique<BoxReduction>();
+            using ReduceTuple = typename decltype(reduction->data)::Type;
+            for (auto const* mf : fields) {
+                amrex::Array4<amrex::Real const> const& arr = mf->const_array(mfi);
+                reduction->op.eval(mf->box(ibox), mf->nComp(), reduction->data,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) -> ReduceTuple
+                    {
+                        return {(std::abs(arr(i,j,k,n)) > threshold) ? 1 : 0};
+                    });
+            }
+            reductions.emplace_back(ibox, std::move(reduction));
+        }
+        for (auto& [ibox, reduction] : reductions) {
+            if (amrex::get<0>(reduction->data.value(reduction->op)) > 0) { active[ibox] = 1; }
+        }
+    }
+}
+
+void
+WarpX::UpdateFrozenBoxes (int step)
+{
+    using ablastr::fields::Direction;
+    using warpx::fields::FieldType;
+
+    constexpr int lev = 0;
+    m_frozen_boxes.resize(1);
+    m_active_boxes.resize(1);
+
+    amrex::BoxArray const& ba = boxArray(lev);
+    amrex::DistributionMapping const& dm = DistributionMap(lev);
+
+    // Recompute the frozen boxes at the requested interval, after a load balance,
+    // and as soon as particles appear in a box that was not active (e.g. by flux
+    // injection, from Python or from a plugin), since the margin does not cover them
+    bool const layout_changed = !m_frozen_boxes[lev] ||
+        m_frozen_boxes[lev]->boxArray() != ba ||
+        m_frozen_boxes[lev]->DistributionMap() != dm;
+    if (!layout_changed && (step % m_freeze_empty_boxes_interval != 0)) {
+        bool new_particles = false;
+        for (int i = 0; i < mypc->nContainers(); ++i) {
+            auto& pc = mypc->GetParticleContainer(i);
+            for (WarpXParIter pti(pc, lev); pti.isValid(); ++pti) {
+                if (pti.numParticles() > 0 && !(*m_active_boxes[lev])[pti.index()]) {
+                    new_particles = true;
+                }
+            }
+        }
+        amrex::ParallelDescriptor::ReduceBoolOr(new_particles);
+        if (!new_particles) { return; }
+    }
+
+    ABLASTR_PROFILE("WarpX::UpdateFrozenBoxes()");
+
+    // Find the boxes that are active, i.e. that contain particles,
+    // non-vanishing fields or embedded boundaries
+    amrex::Vector<int> active(ba.size(), 0);
+
+    for (int i = 0; i < mypc->nContainers(); ++i) {
+        auto& pc = mypc->GetParticleContainer(i);
+        for (WarpXParIter pti(pc, lev); pti.isValid(); ++pti) {
+            if (pti.numParticles() > 0) { active[pti.index()] = 1; }
+        }
+    }
+
+    amrex::Vector<amrex::MultiFab const*> fields;
+    for (int idim = 0; idim < 3; ++idim) {
+        fields.push_back(m_fields.get(FieldType::Efield_fp, Direction{idim}, lev));
+        fields.push_back(m_fields.get(FieldType::Bfield_fp, Direction{idim}, lev));
+        fields.push_back(m_fields.get(FieldType::current_fp, Direction{idim}, lev));
+    }
+    if (m_fields.has(FieldType::F_fp, lev)) { fields.push_back(m_fields.get(FieldType::F_fp, lev)); }
+    if (m_fields.has(FieldType::G_fp, lev)) { fields.push_back(m_fields.get(FieldType::G_fp, lev)); }
+
+    auto const* eb_box_type = EB::enabled() ? GetEBBoxType(lev) : nullptr;
+    if (eb_box_type && (eb_box_type->boxArray() != ba || eb_box_type->DistributionMap() != dm)) {
+        eb_box_type = nullptr;
+    }
+
+    if (EB::enabled()) {
+        for (amrex::MFIter mfi(*fields[0]); mfi.isValid(); ++mfi) {
+            if (eb_box_type == nullptr ||
+                (*eb_box_type)[mfi] != warpx::embedded_boundary::EBBoxType::Regular) {
+                active[mfi.index()] = 1;
+            }
+        }
+    }
+
+    markNonVanishingBoxes(fields, m_freeze_empty_boxes_threshold, active);
+
+    amrex::ParallelDescriptor::ReduceIntMax(active.data(), static_cast<int>(active.size()));
+
+    // Number of cells that fields and particles can travel until the next update:
+    // each push of E or B widens the region of non-vanishing fields by one cell
+    // (three pushes per step), the filter by its number of passes, and the
+    // particles move by less than one cell per step (CFL). The particle shape
+    // and one extra cell account for the deposition and the interpolation.
+    int reach_per_step = 3 + 1;
+    if (use_filter) { reach_per_step += filter_npass_each_dir.max(); }
+    int const margin = m_freeze_empty_boxes_interval * reach_per_step + nox + 1;
+
+    amrex::BoxList active_bl;
+    for (int ibox = 0; ibox < ba.size(); ++ibox) {
+        if (active[ibox]) { active_bl.push_back(amrex::grow(ba[ibox], margin)); }
+    }
+    amrex::BoxArray const active_ba(std::move(active_bl));
+
+    auto const shifts = Geom(lev).periodicity().shiftIntVect();
+
+    auto frozen = std::make_unique<amrex::LayoutData<int>>(ba, dm);
+    auto active_local = std::make_unique<amrex::LayoutData<int>>(ba, dm);
+    int n_frozen = 0;
+    for (amrex::MFIter mfi(*frozen); mfi.isValid(); ++mfi) {
+        amrex::Box const& bx = ba[mfi.index()];
+        bool const near_active = std::any_of(shifts.begin(), shifts.end(),
+            [&] (amrex::IntVect const& shift) { return active_ba.intersects(bx + shift); });
+        (*frozen)[mfi] = near_active ? 0 : 1;
+        (*active_local)[mfi] = active[mfi.index()];
+        n_frozen += (*frozen)[mfi];
+    }
+    m_frozen_boxes[lev] = std::move(frozen);
+    m_active_boxes[lev] = std::move(active_local);
+
+    if (verbose) {
+        amrex::ParallelDescriptor::ReduceIntSum(n_frozen);
+        amrex::Print() << Utils::TextMsg::Info(
+            "Frozen boxes: " + std::to_string(n_frozen) + " of " + std::to_string(ba.size()));
+    }
+}
@@ -294,6 +294,7 @@ void EffectivePotentialES::computePhi (
         post_phi_calculation,
         *m_poisson_boundary_handler,
         warpx.gett_new(0),
-        eb_farray_box_factory
+        eb_farray_box_factory,
+        m_phi_solver_state.get()
     );
 }
@@ -50,6 +50,17 @@ void ElectrostaticSolver::ReadParameters () {
     // FFT solver flags
     utils::parser::queryWithParser(
         pp_warpx, "use_2d_slices_fft_solver", is_igf_2d_slices);
+
+    // MLMG warm start
+    utils::parser::queryWithParser(
+        pp_warpx, "self_fields_reuse_solver", self_fields_reuse_solver);
+    utils::parser::queryWithParser(
+        pp_warpx, "self_fields_phi_extrapolation_order", self_fields_phi_extrapolation_order);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        self_fields_phi_extrapolation_order >= 0 && self_fields_phi_extrapolation_order <= 2,
+        "warpx.self_fields_phi_extrapolation_order must be 0, 1 or 2");
+    m_phi_solver_state = std::make_unique<ablastr::fields::PoissonSolverState>(
+        self_fields_reuse_solver, self_fields_phi_extrapolation_order);
 }
 
 void
@@ -136,7 +147,8 @@ ElectrostaticSolver::computePhi (
     int const max_iters,
     int const verbosity,
     bool const is_igf_2d,
-    std::optional<ablastr::fields::MultiLevelVectorField> efield
+    std::optional<ablastr::fields::MultiLevelVectorField> efield,
+    ablastr::fields::PoissonSolverState* solver_state
 ) const
 {
     // create a vector to our fields, sorted by level
@@ -224,7 +236,8 @@ ElectrostaticSolver::computePhi (
         post_phi_calculation,
         *m_poisson_boundary_handler,
         warpx.gett_new(0),
-        eb_farray_box_factory
+        eb_farray_box_factory,
+        solver_state
     );
 
 }
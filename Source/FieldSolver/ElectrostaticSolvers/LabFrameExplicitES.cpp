@@ -77,7 +77,8 @@ void LabFrameExplicitES::ComputeSpaceChargeField (
         // Use the AMREX MLMG or the FFT (IGF) solver otherwise
         computePhi(rho_fp, phi_fp, beta, self_fields_required_precision,
                    self_fields_absolute_tolerance, self_fields_max_iters,
-                   self_fields_verbosity, is_igf_2d_slices, Efield_fp);
+                   self_fields_verbosity, is_igf_2d_slices, Efield_fp,
+                   m_phi_solver_state.get());
 #endif
 
     }
@@ -126,11 +126,17 @@ void RelativisticExplicitES::AddSpaceChargeField (
         beta[i] = beta_pr[i]/PhysConst::c; // Normalize
     }
 
+    // The MLMG state is kept per species, since each species has its own beta
+    auto const [state_it, state_is_new] = m_species_solver_state.try_emplace(
+        pc.getName(), self_fields_reuse_solver, self_fields_phi_extrapolation_order);
+    amrex::ignore_unused(state_is_new);
+
     // Compute the potential phi, by solving the Poisson equation
     computePhi( amrex::GetVecOfPtrs(rho), amrex::GetVecOfPtrs(phi),
                 beta, pc.self_fields_required_precision,
                 pc.self_fields_absolute_tolerance, pc.self_fields_max_iters,
-                pc.self_fields_verbosity, is_igf_2d_slices);
+                pc.self_fields_verbosity, is_igf_2d_slices,
+                std::nullopt, &(state_it->second));
 
     // Compute the corresponding electric and magnetic field, from the potential phi
     computeE( Efield_fp, amrex::GetVecOfPtrs(phi), beta );
@@ -168,7 +174,8 @@ void RelativisticExplicitES::AddBoundaryField (ablastr::fields::MultiLevelVector
     computePhi( amrex::GetVecOfPtrs(rho), amrex::GetVecOfPtrs(phi),
                 beta, self_fields_required_precision,
                 self_fields_absolute_tolerance, self_fields_max_iters,
-                self_fields_verbosity, is_igf_2d_slices);
+                self_fields_verbosity, is_igf_2d_slices,
+                std::nullopt, m_phi_solver_state.get());
 
     // Compute the corresponding electric field, from the potential phi.
     computeE( Efield_fp, amrex::GetVecOfPtrs(phi), beta );
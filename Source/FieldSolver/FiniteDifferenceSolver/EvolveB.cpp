@@ -56,6 +56,7 @@ void FiniteDifferenceSolver::EvolveB (
     PatchType patch_type,
     [[maybe_unused]] std::array< std::unique_ptr<amrex::iMultiFab>, 3 >& flag_info_cell,
     [[maybe_unused]] std::array< std::unique_ptr<amrex::LayoutData<FaceInfoBox> >, 3 >& borrowing,
+    [[maybe_unused]] amrex::LayoutData<int> const* frozen_boxes,
     [[maybe_unused]] amrex::Real const dt )
 {
 
@@ -103,16 +104,16 @@ void FiniteDifferenceSolver::EvolveB (
 
     if (m_grid_type == GridType::Collocated) {
 
-        EvolveBCartesian <CartesianNodalAlgorithm> ( Bfield, Efield, Gfield, lev, dt );
+        EvolveBCartesian <CartesianNodalAlgorithm> ( Bfield, Efield, Gfield, frozen_boxes, lev, dt );
 
     } else if ((m_fdtd_algo == ElectromagneticSolverAlgo::Yee) ||
                (m_fdtd_algo == ElectromagneticSolverAlgo::HybridPIC)) {
 
-        EvolveBCartesian <CartesianYeeAlgorithm> ( Bfield, Efield, Gfield, lev, dt );
+        EvolveBCartesian <CartesianYeeAlgorithm> ( Bfield, Efield, Gfield, frozen_boxes, lev, dt );
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
 
-        EvolveBCartesian <CartesianCKCAlgorithm> ( Bfield, Efield, Gfield, lev, dt );
+        EvolveBCartesian <CartesianCKCAlgorithm> ( Bfield, Efield, Gfield, frozen_boxes, lev, dt );
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::ECT) {
         EvolveBCartesianECT(Bfield, face_areas, area_mod, ECTRhofield, Venl, flag_info_cell,
                             borrowing, lev, dt);
@@ -130,15 +131,25 @@ void FiniteDifferenceSolver::EvolveBCartesian (
     ablastr::fields::VectorField const& Bfield,
     ablastr::fields::VectorField const& Efield,
     amrex::MultiFab const * Gfield,
+    amrex::LayoutData<int> const* frozen_boxes,
     int lev, amrex::Real const dt ) {
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
+    // Boxes far from particles and non-vanishing fields, in which the update is skipped
+    amrex::LayoutData<int> const* frozen_box = frozen_boxes;
+    if (frozen_box && (!frozen_box->boxArray().CellEqual(Bfield[0]->boxArray()) ||
+                       frozen_box->DistributionMap() != Bfield[0]->DistributionMap())) {
+        frozen_box = nullptr;
+    }
+
     // Loop through the grids, and over the tiles within each grid
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Bfield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+        if (frozen_box && (*frozen_box)[mfi.index()]) { continue; }
+
         if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
         {
             amrex::Gpu::synchronize();
@@ -58,6 +58,8 @@ void FiniteDifferenceSolver::EvolveE (
     PatchType patch_type,
     ablastr::fields::VectorField const& Efield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
+    amrex::LayoutData<int> const* eb_no_update_boxes,
+    amrex::LayoutData<int> const* frozen_boxes,
     amrex::Real const dt
 )
 {
@@ -79,23 +81,24 @@ void FiniteDifferenceSolver::EvolveE (
     // but we compile code for each algorithm, using templates)
 #if defined(WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER)
     if (m_fdtd_algo == ElectromagneticSolverAlgo::Yee){
-        EvolveECylindrical <CylindricalYeeAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt );
+        amrex::ignore_unused(frozen_boxes);
+        EvolveECylindrical <CylindricalYeeAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, eb_no_update_boxes, Ffield, lev, dt );
 #elif defined(WARPX_DIM_RSPHERE)
     if (m_fdtd_algo == ElectromagneticSolverAlgo::Yee){
-        amrex::ignore_unused(eb_update_E);
+        amrex::ignore_unused(eb_update_E, eb_no_update_boxes, frozen_boxes);
         EvolveESpherical <SphericalYeeAlgorithm> ( Efield, Bfield, Jfield, Ffield, lev, dt );
 #else
     if (m_grid_type == GridType::Collocated) {
 
-        EvolveECartesian <CartesianNodalAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt );
+        EvolveECartesian <CartesianNodalAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, eb_no_update_boxes, Ffield, frozen_boxes, lev, dt );
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::Yee || m_fdtd_algo == ElectromagneticSolverAlgo::ECT) {
 
-        EvolveECartesian <CartesianYeeAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt );
+        EvolveECartesian <CartesianYeeAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, eb_no_update_boxes, Ffield, frozen_boxes, lev, dt );
 
     } else if (m_fdtd_algo == ElectromagneticSolverAlgo::CKC) {
 
-        EvolveECartesian <CartesianCKCAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, Ffield, lev, dt );
+        EvolveECartesian <CartesianCKCAlgorithm> ( Efield, Bfield, Jfield, eb_update_E, eb_no_update_boxes, Ffield, frozen_boxes, lev, dt );
 
 #endif
     } else {
@@ -113,10 +116,27 @@ void FiniteDifferenceSolver::EvolveECartesian (
     ablastr::fields::VectorField const& Bfield,
     ablastr::fields::VectorField const& Jfield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3> const& eb_update_E,
+    amrex::LayoutData<int> const* eb_no_update_boxes,
     amrex::MultiFab const* Ffield,
+    amrex::LayoutData<int> const* frozen_boxes,
     int lev, amrex::Real const dt ) {
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
+
+    // Boxes fully covered by the embedded boundary, in which no point of E is updated
+    amrex::LayoutData<int> const* no_update_box = eb_no_update_boxes;
+    if (no_update_box && (no_update_box->boxArray() != Efield[0]->boxArray() ||
+                          no_update_box->DistributionMap() != Efield[0]->DistributionMap())) {
+        no_update_box = nullptr;
+    }
+
+    // Boxes far from particles and non-vanishing fields, in which the update is skipped
+    amrex::LayoutData<int> const* frozen_box = frozen_boxes;
+    if (frozen_box && (!frozen_box->boxArray().CellEqual(Efield[0]->boxArray()) ||
+                       frozen_box->DistributionMap() != Efield[0]->DistributionMap())) {
+        frozen_box = nullptr;
+    }
+
     Real constexpr c2 = PhysConst::c2;
 
     // Loop through the grids, and over the tiles within each grid
@@ -124,6 +144,8 @@ void FiniteDifferenceSolver::EvolveECartesian (
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
     for ( MFIter mfi(*Efield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+        if (frozen_box && (*frozen_box)[mfi.index()]) { continue; }
+
         if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
         {
             amrex::Gpu::synchronize();
@@ -162,8 +184,14 @@ void FiniteDifferenceSolver::EvolveECartesian (
         Box const& tey  = mfi.tilebox(Efield[1]->ixType().toIntVect());
         Box const& tez  = mfi.tilebox(Efield[2]->ixType().toIntVect());
 
+        // Skip the update of the fields if the whole box is covered by the embedded boundary
+        bool const skip_box = no_update_box && (*no_update_box)[mfi.index()];
+        Box const tex_update = skip_box ? Box() : tex;
+        Box const tey_update = skip_box ? Box() : tey;
+        Box const tez_update = skip_box ? Box() : tez;
+
         // Loop over the cells and update the fields
-        amrex::ParallelFor(tex, tey, tez,
+        amrex::ParallelFor(tex_update, tey_update, tez_update,
 
             [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
@@ -242,11 +270,19 @@ void FiniteDifferenceSolver::EvolveECylindrical (
     ablastr::fields::VectorField const& Bfield,
     ablastr::fields::VectorField const& Jfield,
     std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
+    amrex::LayoutData<int> const* eb_no_update_boxes,
     amrex::MultiFab const* Ffield,
     int lev, amrex::Real const dt ) {
 
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
+    // Boxes fully covered by the embedded boundary, in which no point of E is updated
+    amrex::LayoutData<int> const* no_update_box = eb_no_update_boxes;
+    if (no_update_box && (no_update_box->boxArray() != Efield[0]->boxArray() ||
+                          no_update_box->DistributionMap() != Efield[0]->DistributionMap())) {
+        no_update_box = nullptr;
+    }
+
     // Loop through the grids, and over the tiles within each grid
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
@@ -295,8 +331,14 @@ void FiniteDifferenceSolver::EvolveECylindrical (
 
         Real constexpr c2 = PhysConst::c2;
 
+        // Skip the update of the fields if the whole box is covered by the embedded boundary
+        bool const skip_box = no_update_box && (*no_update_box)[mfi.index()];
+        Box const ter_update = skip_box ? Box() : ter;
+        Box const tet_update = skip_box ? Box() : tet;
+        Box const tez_update = skip_box ? Box() : tez;
+
         // Loop over the cells and update the fields
-        amrex::ParallelFor(ter, tet, tez,
+        amrex::ParallelFor(ter_update, tet_update, tez_update,
 
             [=] AMREX_GPU_DEVICE (int i, int j, int /*k*/){
 
@@ -25,6 +25,8 @@
 
 #include <AMReX_Random.H>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -65,6 +67,30 @@ void HybridPICModel::ReadParameters ()
     utils::parser::queryWithParser(pp_hybrid, "substep_max_growth", m_substep_max_growth);
     pp_hybrid.query("max_substep_attempts", m_max_substep_attempts);
 
+    // adaptive substepping: the RKF45 controller is used at every step
+    utils::parser::queryWithParser(pp_hybrid, "adaptive_substeps", m_adaptive_substeps);
+    m_max_substeps = m_max_substep_attempts;
+    utils::parser::queryWithParser(pp_hybrid, "min_substeps", m_min_substeps);
+    utils::parser::queryWithParser(pp_hybrid, "max_substeps", m_max_substeps);
+    utils::parser::queryWithParser(pp_hybrid, "substep_min_factor", m_substep_min_factor);
+    // the substeps are split evenly between the two half-steps
+    m_min_substeps = std::max(m_min_substeps + (m_min_substeps % 2), 2);
+    m_max_substeps -= (m_max_substeps % 2);
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_max_substeps >= m_min_substeps,
+        "hybrid_pic_model.max_substeps must be larger than hybrid_pic_model.min_substeps");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        m_substep_min_factor > 0._rt && m_substep_min_factor < 1._rt,
+        "hybrid_pic_model.substep_min_factor must be in (0, 1)");
+
+    // compute the plasma current and the E-field in a single pass at each substep
+    pp_hybrid.query("fuse_substep_kernels", m_fuse_substep_kernels);
+#if defined(WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        !m_fuse_substep_kernels,
+        "hybrid_pic_model.fuse_substep_kernels is only supported in Cartesian geometries.");
+#endif
+
     utils::parser::queryWithParser(pp_hybrid, "holmstrom_vacuum_region", m_holmstrom_vacuum_region);
 
     // The hybrid model requires an electron temperature, reference density
@@ -562,6 +588,43 @@ void HybridPICModel::HybridPICSolveE (
     warpx.ApplyEfieldBoundary(lev, patch_type, time);
 }
 
+void HybridPICModel::HybridPICSolveEFused (
+    ablastr::fields::MultiLevelVectorField const& Efield,
+    ablastr::fields::MultiLevelVectorField const& Jfield,
+    ablastr::fields::MultiLevelVectorField const& Bfield,
+    ablastr::fields::MultiLevelScalarField const& rhofield,
+    amrex::Vector<std::array< std::unique_ptr<amrex::iMultiFab>,3 > >& eb_update_E) const
+{
+    ABLASTR_PROFILE("HybridPICModel::HybridPICSolveEFused()");
+
+    auto& warpx = WarpX::GetInstance();
+    for (int lev = 0; lev <= warpx.finestLevel(); ++lev)
+    {
+        if (lev > 0)
+        {
+            amrex::Abort(Utils::TextMsg::Err(
+            "HybridPICSolveEFused: Only one level implemented for hybrid-PIC solver."));
+        }
+
+        ablastr::fields::VectorField current_fp_plasma = warpx.m_fields.get_alldirs(FieldType::hybrid_current_fp_plasma, lev);
+        ablastr::fields::VectorField current_fp_external {};
+        if (m_has_external_current) {
+            current_fp_external = warpx.m_fields.get_alldirs(FieldType::hybrid_current_fp_external, lev);
+        }
+
+        // Calculate J = curl x B / mu0 - J_ext and solve for the E field
+        // in regular cells
+        warpx.get_pointer_fdtd_solver_fp(lev)->HybridPICSolveEFused(
+            Efield[lev], current_fp_plasma, current_fp_external, Jfield[lev],
+            Bfield[lev], *rhofield[lev], eb_update_E[lev], lev, this
+        );
+        amrex::Real const time = warpx.gett_old(0) + warpx.getdt(0);
+        warpx.ApplyEfieldBoundary(lev, PatchType::fine, time);
+    }
+    // Allow execution of Python callback after E-field push
+    ExecutePythonCallback("afterEpush");
+}
+
 void HybridPICModel::CalculateElectronPressure(bool const floor_density) const
 {
     auto& warpx = WarpX::GetInstance();
@@ -1524,6 +1587,20 @@ void HybridPICModel::AdvanceElectronEnergyQDSMC (amrex::Real const dt) const
 }
 
 
+int HybridPICModel::GetSubsteps (int lev)
+{
+    if (static_cast<int>(m_level_substeps.size()) <= lev) {
+        m_level_substeps.resize(lev+1, m_substeps);
+    }
+    return m_level_substeps[lev];
+}
+
+void HybridPICModel::SetSubsteps (int substeps)
+{
+    m_substeps = substeps;
+    for (auto& lev_substeps : m_level_substeps) { lev_substeps = substeps; }
+}
+
 void HybridPICModel::BfieldEvolve (
     ablastr::fields::MultiLevelVectorField const& Bfield,
     ablastr::fields::MultiLevelVectorField const& Efield,
@@ -1569,11 +1646,26 @@ void HybridPICModel::BfieldEvolve (
         MultiFab::Copy(B_old[ii], *Bfield[lev][ii], 0, 1, 1, ng);
     }
 
-    amrex::Real dt_sub = dt_half / (m_substeps / 2._rt);
+    int substeps = GetSubsteps(lev);
+    amrex::Real dt_sub = dt_half / (substeps / 2._rt);
     amrex::Real t = 0._rt;
     int n_attempts = 0;
     int n_accepted = 0;
 
+    // Bounds on the substep size in adaptive mode
+    const amrex::Real dt_sub_min = dt_half / (m_max_substeps / 2._rt);
+    const amrex::Real dt_sub_max = dt_half / (m_min_substeps / 2._rt);
+    if (m_adaptive_substeps) { dt_sub = std::clamp(dt_sub, dt_sub_min, dt_sub_max); }
+    // Substep size proposed by the error controller for the next half-step
+    // (not affected by the truncation of the last substep)
+    amrex::Real dt_sub_next = dt_sub;
+    bool forced_acceptance = false;
+
+    // The statistics cover both half-steps of a timestep
+    GetSubstepStatistics(lev);
+    SubstepStatistics& stats = m_substep_stats[lev];
+    if (subcycling_half == SubcyclingHalf::FirstHalf) { stats = SubstepStatistics{}; }
+
     // Step the magnetic field forward (from t -> t + dt_half) using the user
     // specified integration scheme. The loop is set up such that the timestep
     // for a given step (dt_sub) can be modified within the loop, i.e.,
@@ -1581,7 +1673,8 @@ void HybridPICModel::BfieldEvolve (
     while (t < dt_half)
     {
         // Adjust size of the last substep, so as to land exactly at t+dt_half.
-        if (t + dt_sub > dt_half) { dt_sub = dt_half - t; }
+        const bool is_truncated = (t + dt_sub > dt_half);
+        if (is_truncated) { dt_sub = dt_half - t; }
         bool step_succeeded = true;
         amrex::Real step_change_factor = 1.0_rt;
 
@@ -1594,6 +1687,13 @@ void HybridPICModel::BfieldEvolve (
             step_change_factor = m_substep_safety * std::pow(error + 1.e-10_rt, -0.2_rt);
             step_succeeded = (error <= 1._rt);
 
+            // The substep size cannot be reduced below the bound set by
+            // max_substeps: accept the step anyway
+            if (m_adaptive_substeps && !step_succeeded && dt_sub <= dt_sub_min) {
+                step_succeeded = true;
+                forced_acceptance = true;
+            }
+
         } else {
             BfieldEvolveRK4(
                 Bfield, Efield, Jfield, rhofield, eb_update_E, B_old,
@@ -1628,6 +1728,9 @@ void HybridPICModel::BfieldEvolve (
             // update time tracker and accepted steps number
             t += dt_sub;
             ++n_accepted;
+            stats.dt_sub_min = (stats.n_accepted + n_accepted == 1) ?
+                dt_sub : std::min(stats.dt_sub_min, dt_sub);
+            stats.dt_sub_max = std::max(stats.dt_sub_max, dt_sub);
             // update B_old to the current Bfield
             for (int ii = 0; ii < 3; ii++) {
                 MultiFab::Copy(B_old[ii], *Bfield[lev][ii], 0, 0, 1, ng);
@@ -1638,7 +1741,16 @@ void HybridPICModel::BfieldEvolve (
             for (int ii = 0; ii < 3; ii++) {
                 MultiFab::Copy(*Bfield[lev][ii], B_old[ii], 0, 0, 1, ng);
             }
-            dt_sub *= std::max(0.1_rt, step_change_factor);
+            dt_sub *= std::max(m_substep_min_factor, step_change_factor);
+        }
+
+        if (m_adaptive_substeps) { dt_sub = std::clamp(dt_sub, dt_sub_min, dt_sub_max); }
+        // A truncated substep that is accepted says nothing about the step
+        // size the controller would pick: keep the previous proposal then
+        if (!is_truncated) {
+            dt_sub_next = dt_sub;
+        } else if (!step_succeeded) {
+            dt_sub_next = std::min(dt_sub_next, dt_sub);
         }
 
         if (++n_attempts > m_max_substep_attempts) { break; }
@@ -1653,31 +1765,48 @@ void HybridPICModel::BfieldEvolve (
     // N < M (e.g. m=40, n_attempts=10 → 38 → … → 20). Floating-point
     // 0.95*M+0.05*N can undershoot M slightly so floor would leak even at
     // equilibrium.
-    {
+    // In adaptive mode, the next half-step directly starts from the substep
+    // size proposed by the error controller, within the user bounds.
+    if (m_adaptive_substeps) {
+        const auto half_substeps = static_cast<int>(std::ceil(dt_half / dt_sub_next - 1.e-6_rt));
+        substeps = std::clamp(2 * half_substeps, m_min_substeps, m_max_substeps);
+    } else {
         const int target = 2 * n_attempts;
-        if (m_substeps < target) {
-            m_substeps = target;
+        if (substeps < target) {
+            substeps = target;
         } else {
-            const int M = m_substeps / 2;
+            const int M = substeps / 2;
             const int N = n_attempts;
             const int relaxed = 2 * ((19 * M + N) / 20);
-            m_substeps = std::max(relaxed, 2);
+            substeps = std::max(relaxed, 2);
         }
         // Stay within the abort budget so the controller cannot request more
         // substeps than max_substep_attempts allows.
-        if (m_substeps > m_max_substep_attempts) {
-            m_substeps = m_max_substep_attempts - (m_max_substep_attempts % 2);
-            m_substeps = std::max(m_substeps, 2);
+        if (substeps > m_max_substep_attempts) {
+            substeps = m_max_substep_attempts - (m_max_substep_attempts % 2);
+            substeps = std::max(substeps, 2);
         }
     }
+    m_level_substeps[lev] = substeps;
+
+    stats.n_accepted += n_accepted;
+    stats.n_rejected += n_attempts - n_accepted;
+
+    if (forced_acceptance) {
+        ablastr::warn_manager::WMRecordWarning(
+            "HybridPIC",
+            "The RKF45 error tolerance could not be met with the smallest "
+            "allowed substep size; consider increasing hybrid_pic_model.max_substeps.",
+            ablastr::warn_manager::WarnPriority::low);
+    }
 
     if (WarpX::GetInstance().Verbose()) {
-        amrex::Print() << "B-field update "
+        amrex::Print() << "B-field update on level " << lev << ", "
             << (subcycling_half == SubcyclingHalf::FirstHalf ? "1st" : "2nd") << " half"
             << ": " << n_accepted << " accepted, "
             << (n_attempts - n_accepted) << " rejected substeps"
             << " (dt_sub_final/dt_half = " << dt_sub / dt_half
-            << ", m_substeps = " << m_substeps << ")\n";
+            << ", substeps = " << substeps << ")\n";
     }
     WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
         n_attempts <= m_max_substep_attempts,
@@ -2230,10 +2359,16 @@ void HybridPICModel::FieldPush (
 
     amrex::Real const t_old = warpx.gett_old(0);
 
-    // Calculate J = curl x B / mu0 - J_ext
-    CalculatePlasmaCurrent(Bfield, eb_update_E);
-    // Calculate the E-field from Ohm's law
-    HybridPICSolveE(Efield, Jfield, Bfield, rhofield, eb_update_E, true);
+    if (m_fuse_substep_kernels) {
+        // Calculate J = curl x B / mu0 - J_ext and the E-field from Ohm's
+        // law in a single pass
+        HybridPICSolveEFused(Efield, Jfield, Bfield, rhofield, eb_update_E);
+    } else {
+        // Calculate J = curl x B / mu0 - J_ext
+        CalculatePlasmaCurrent(Bfield, eb_update_E);
+        // Calculate the E-field from Ohm's law
+        HybridPICSolveE(Efield, Jfield, Bfield, rhofield, eb_update_E, true);
+    }
     // Call FillBoundary if a collocated grid is used
     if (Bz_IndexType[0] == Ez_IndexType[0]) {
         warpx.FillBoundaryE(ng, nodal_sync);
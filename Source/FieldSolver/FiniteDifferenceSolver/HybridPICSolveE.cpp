@@ -514,6 +514,40 @@ void FiniteDifferenceSolver::HybridPICSolveE (
     }
 }
 
+void FiniteDifferenceSolver::HybridPICSolveEFused (
+    [[maybe_unused]] ablastr::fields::VectorField const& Efield,
+    [[maybe_unused]] ablastr::fields::VectorField const& Jfield,
+    [[maybe_unused]] ablastr::fields::VectorField const& Jextfield,
+    [[maybe_unused]] ablastr::fields::VectorField const& Jifield,
+    [[maybe_unused]] ablastr::fields::VectorField const& Bfield,
+    [[maybe_unused]] amrex::MultiFab const& rhofield,
+    [[maybe_unused]] std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
+    [[maybe_unused]] int lev, [[maybe_unused]] HybridPICModel const* hybrid_model)
+{
+    if (m_fdtd_algo == ElectromagneticSolverAlgo::HybridPIC) {
+#if defined(WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
+        amrex::Abort(Utils::TextMsg::Err(
+            "HybridPICSolveEFused: only implemented in Cartesian geometries"));
+#else
+    if (WarpX::grid_type == GridType::Staggered)
+    {
+        HybridPICSolveEFusedCartesian <CartesianYeeAlgorithm> (
+            Efield, Jfield, Jextfield, Jifield, Bfield, rhofield,
+            eb_update_E, lev, hybrid_model
+        );
+    } else {
+        HybridPICSolveEFusedCartesian <CartesianNodalAlgorithm> (
+            Efield, Jfield, Jextfield, Jifield, Bfield, rhofield,
+            eb_update_E, lev, hybrid_model
+        );
+    }
+#endif
+    } else {
+        amrex::Abort(Utils::TextMsg::Err(
+            "HybridPICSolveEFused: The hybrid-PIC electromagnetic solver algorithm must be used"));
+    }
+}
+
 #if defined(WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER)
 template<typename T_Algo>
 void FiniteDifferenceSolver::HybridPICSolveECylindrical (
@@ -965,6 +999,198 @@ void FiniteDifferenceSolver::HybridPICSolveESpherical (
 }
 #else
 
+namespace
+{
+    /** Parameters of the generalized Ohm's law that are uniform over a level */
+    struct HybridOhmsLawCoefs
+    {
+        amrex::ParserExecutor<3> eta;
+        amrex::ParserExecutor<2> eta_h;
+        amrex::Real rho_floor;
+        amrex::Real t_new;
+        bool resistivity_has_J_dependence;
+        bool hyper_resistivity_has_B_dependence;
+        bool include_hyper_resistivity_term;
+        bool include_external_fields;
+        bool holmstrom_vacuum_region;
+        // staggering of the E, J and B components
+        amrex::GpuArray<amrex::GpuArray<int, 3>, 3> E_stag;
+        amrex::GpuArray<amrex::GpuArray<int, 3>, 3> J_stag;
+        amrex::GpuArray<amrex::GpuArray<int, 3>, 3> B_stag;
+        // finite-difference stencil coefficients
+        amrex::Real const* coefs_x;
+        int n_coefs_x;
+        amrex::Real const* coefs_y;
+        int n_coefs_y;
+        amrex::Real const* coefs_z;
+        int n_coefs_z;
+    };
+
+    HybridOhmsLawCoefs
+    getHybridOhmsLawCoefs (
+        HybridPICModel const* hybrid_model, int lev,
+        amrex::Gpu::DeviceVector<amrex::Real> const& stencil_coefs_x,
+        amrex::Gpu::DeviceVector<amrex::Real> const& stencil_coefs_y,
+        amrex::Gpu::DeviceVector<amrex::Real> const& stencil_coefs_z )
+    {
+        HybridOhmsLawCoefs c;
+        c.eta = hybrid_model->m_eta;
+        c.eta_h = hybrid_model->m_eta_h;
+        c.rho_floor = hybrid_model->m_n_floor * PhysConst::q_e;
+        c.t_new = WarpX::GetInstance().gett_new(lev);
+        c.resistivity_has_J_dependence = hybrid_model->m_resistivity_has_J_dependence;
+        c.hyper_resistivity_has_B_dependence = hybrid_model->m_hyper_resistivity_has_B_dependence;
+        c.include_hyper_resistivity_term = hybrid_model->m_include_hyper_resistivity_term;
+        c.include_external_fields = hybrid_model->m_add_external_fields;
+        c.holmstrom_vacuum_region = hybrid_model->m_holmstrom_vacuum_region;
+        c.E_stag = {hybrid_model->Ex_IndexType, hybrid_model->Ey_IndexType, hybrid_model->Ez_IndexType};
+        c.J_stag = {hybrid_model->Jx_IndexType, hybrid_model->Jy_IndexType, hybrid_model->Jz_IndexType};
+        c.B_stag = {hybrid_model->Bx_IndexType, hybrid_model->By_IndexType, hybrid_model->Bz_IndexType};
+        c.coefs_x = stencil_coefs_x.dataPtr();
+        c.n_coefs_x = static_cast<int>(stencil_coefs_x.size());
+        c.coefs_y = stencil_coefs_y.dataPtr();
+        c.n_coefs_y = static_cast<int>(stencil_coefs_y.size());
+        c.coefs_z = stencil_coefs_z.dataPtr();
+        c.n_coefs_z = static_cast<int>(stencil_coefs_z.size());
+        return c;
+    }
+
+    using Array4Triplet = amrex::GpuArray<amrex::Array4<amrex::Real const>, 3>;
+
+    /** Calculate enE = (J - Ji) x B at the node (i, j, k), into the 3 components of `enE`
+     *
+     * This term is calculated on a nodal mesh in order to ensure energy conservation.
+     */
+    AMREX_GPU_DEVICE AMREX_FORCE_INLINE
+    void OhmsLawNodalJxB (
+        int i, int j, int k,
+        amrex::Array4<amrex::Real> const& enE,
+        HybridOhmsLawCoefs const& c,
+        Array4Triplet const& J, Array4Triplet const& Ji,
+        Array4Triplet const& B, Array4Triplet const& B_ext )
+    {
+        using ablastr::coarsen::sample::Interp;
+
+        // Parameters for `interp` that maps from Yee to nodal mesh and back
+        amrex::GpuArray<int, 3> const nodal = {1, 1, 1};
+        // The "coarsening is just 1 i.e. no coarsening"
+        amrex::GpuArray<int, 3> const coarsen = {1, 1, 1};
+
+        amrex::Real dj[3];
+        amrex::Real b[3];
+        for (int d = 0; d < 3; ++d) {
+            // interpolate the total plasma current and the ion current to a nodal grid
+            dj[d] = Interp(J[d], c.J_stag[d], nodal, coarsen, i, j, k, 0)
+                  - Interp(Ji[d], c.J_stag[d], nodal, coarsen, i, j, k, 0);
+
+            // interpolate the B field to a nodal grid
+            b[d] = Interp(B[d], c.B_stag[d], nodal, coarsen, i, j, k, 0);
+            if (c.include_external_fields) {
+                b[d] += Interp(B_ext[d], c.B_stag[d], nodal, coarsen, i, j, k, 0);
+            }
+        }
+
+        enE(i, j, k, 0) = dj[1] * b[2] - dj[2] * b[1];
+        enE(i, j, k, 1) = dj[2] * b[0] - dj[0] * b[2];
+        enE(i, j, k, 2) = dj[0] * b[1] - dj[1] * b[0];
+    }
+
+    /** Calculate the component `dir` of the E-field at its Yee location (i, j, k)
+     *
+     * The nodal enE values are averaged onto the Yee grid and the electron
+     * pressure, resistivity and external field terms are added (these terms
+     * are naturally located on the Yee grid).
+     */
+    template<typename T_Algo>
+    AMREX_GPU_DEVICE AMREX_FORCE_INLINE
+    amrex::Real OhmsLawYeeE (
+        int dir, int i, int j, int k,
+        HybridOhmsLawCoefs const& c,
+        amrex::Array4<amrex::Real const> const& enE,
+        amrex::Array4<amrex::Real const> const& rho,
+        amrex::Array4<amrex::Real const> const& Pe,
+        Array4Triplet const& J, Array4Triplet const& B,
+        amrex::Array4<amrex::Real const> const& E_ext,
+        bool solve_for_Faraday )
+    {
+        using ablastr::coarsen::sample::Interp;
+
+        amrex::GpuArray<int, 3> const nodal = {1, 1, 1};
+        amrex::GpuArray<int, 3> const coarsen = {1, 1, 1};
+        amrex::GpuArray<int, 3> const& stag = c.E_stag[dir];
+
+        // Interpolate to get the appropriate charge density in space
+        const amrex::Real rho_val = Interp(rho, nodal, stag, coarsen, i, j, k, 0);
+
+        amrex::Real E_val = 0._rt;
+        if (!(rho_val < c.rho_floor && c.holmstrom_vacuum_region)) {
+            // Get the gradient of the electron pressure if the longitudinal part of
+            // the E-field should be included, otherwise ignore it since curl x (grad Pe) = 0
+            amrex::Real grad_Pe = 0._rt;
+            if (!solve_for_Faraday) {
+                if (dir == 0) {
+                    grad_Pe = T_Algo::UpwardDx(Pe, c.coefs_x, c.n_coefs_x, i, j, k);
+                } else if (dir == 1) {
+                    grad_Pe = T_Algo::UpwardDy(Pe, c.coefs_y, c.n_coefs_y, i, j, k);
+                } else {
+                    grad_Pe = T_Algo::UpwardDz(Pe, c.coefs_z, c.n_coefs_z, i, j, k);
+                }
+            }
+
+            // interpolate the nodal neE values to the Yee grid
+            const auto enE_val = Interp(enE, nodal, stag, coarsen, i, j, k, dir);
+
+            // safety condition since we divide by rho
+            const auto rho_val_limited = std::max(rho_val, c.rho_floor);
+
+            E_val = (enE_val - grad_Pe) / rho_val_limited;
+        }
+
+        // Add resistivity only if E field value is used to update B
+        if (solve_for_Faraday) {
+            amrex::Real jtot_val = 0._rt;
+            if (c.resistivity_has_J_dependence) {
+                // Interpolate current to appropriate staggering to match E field
+                amrex::Real j2 = 0._rt;
+                for (int d = 0; d < 3; ++d) {
+                    const amrex::Real j_val = (d == dir) ? J[d](i, j, k)
+                        : Interp(J[d], c.J_stag[d], stag, coarsen, i, j, k, 0);
+                    j2 += j_val*j_val;
+                }
+                jtot_val = std::sqrt(j2);
+            }
+
+            E_val += c.eta(rho_val, jtot_val, c.t_new) * J[dir](i, j, k);
+
+            if (c.include_hyper_resistivity_term) {
+
+                // Interpolate B field to appropriate staggering to match E field
+                amrex::Real btot_val = 0._rt;
+                if (c.hyper_resistivity_has_B_dependence) {
+                    amrex::Real b2 = 0._rt;
+                    for (int d = 0; d < 3; ++d) {
+                        const amrex::Real b_val = Interp(B[d], c.B_stag[d], stag, coarsen, i, j, k, 0);
+                        b2 += b_val*b_val;
+                    }
+                    btot_val = std::sqrt(b2);
+                }
+
+                auto const nabla2J = T_Algo::Dxx(J[dir], c.coefs_x, c.n_coefs_x, i, j, k)
+                    + T_Algo::Dyy(J[dir], c.coefs_y, c.n_coefs_y, i, j, k)
+                    + T_Algo::Dzz(J[dir], c.coefs_z, c.n_coefs_z, i, j, k);
+
+                E_val -= c.eta_h(rho_val, btot_val) * nabla2J;
+            }
+        }
+
+        if (c.include_external_fields && (rho_val >= c.rho_floor)) {
+            E_val -= E_ext(i, j, k);
+        }
+
+        return E_val;
+    }
+}
+
 template<typename T_Algo>
 void FiniteDifferenceSolver::HybridPICSolveECartesian (
     ablastr::fields::VectorField const& Efield,
@@ -980,45 +1206,18 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
     // for the profiler
     amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
-    using namespace ablastr::coarsen::sample;
-
     // get hybrid model parameters
-    const auto eta = hybrid_model->m_eta;
-    const auto eta_h = hybrid_model->m_eta_h;
-    const auto rho_floor = hybrid_model->m_n_floor * PhysConst::q_e;
-    const auto resistivity_has_J_dependence = hybrid_model->m_resistivity_has_J_dependence;
-    const auto hyper_resistivity_has_B_dependence = hybrid_model->m_hyper_resistivity_has_B_dependence;
-    const bool include_hyper_resistivity_term = hybrid_model->m_include_hyper_resistivity_term;
-
-    const bool include_external_fields = hybrid_model->m_add_external_fields;
-
-    const bool holmstrom_vacuum_region = hybrid_model->m_holmstrom_vacuum_region;
+    HybridOhmsLawCoefs const coefs = getHybridOhmsLawCoefs(
+        hybrid_model, lev, m_stencil_coefs_x, m_stencil_coefs_y, m_stencil_coefs_z);
+    const bool include_external_fields = coefs.include_external_fields;
 
     auto & warpx = WarpX::GetInstance();
-    const amrex::Real t_new = warpx.gett_new(lev);
     ablastr::fields::VectorField Bfield_external, Efield_external;
     if (include_external_fields) {
         Bfield_external = warpx.m_fields.get_alldirs(FieldType::hybrid_B_fp_external, 0); // lev=0
         Efield_external = warpx.m_fields.get_alldirs(FieldType::hybrid_E_fp_external, 0); // lev=0
     }
 
-    // Index type required for interpolating fields from their respective
-    // staggering to the Ex, Ey, Ez locations
-    amrex::GpuArray<int, 3> const& Ex_stag = hybrid_model->Ex_IndexType;
-    amrex::GpuArray<int, 3> const& Ey_stag = hybrid_model->Ey_IndexType;
-    amrex::GpuArray<int, 3> const& Ez_stag = hybrid_model->Ez_IndexType;
-    amrex::GpuArray<int, 3> const& Jx_stag = hybrid_model->Jx_IndexType;
-    amrex::GpuArray<int, 3> const& Jy_stag = hybrid_model->Jy_IndexType;
-    amrex::GpuArray<int, 3> const& Jz_stag = hybrid_model->Jz_IndexType;
-    amrex::GpuArray<int, 3> const& Bx_stag = hybrid_model->Bx_IndexType;
-    amrex::GpuArray<int, 3> const& By_stag = hybrid_model->By_IndexType;
-    amrex::GpuArray<int, 3> const& Bz_stag = hybrid_model->Bz_IndexType;
-
-    // Parameters for `interp` that maps from Yee to nodal mesh and back
-    amrex::GpuArray<int, 3> const& nodal = {1, 1, 1};
-    // The "coarsening is just 1 i.e. no coarsening"
-    amrex::GpuArray<int, 3> const& coarsen = {1, 1, 1};
-
     // The E-field calculation is done in 2 steps:
     // 1) The J x B term is calculated on a nodal mesh in order to ensure
     //    energy conservation.
@@ -1048,60 +1247,18 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
         auto wt = static_cast<amrex::Real>(amrex::second());
 
         Array4<Real> const& enE_nodal = enE_nodal_mf.array(mfi);
-        Array4<Real const> const& Jx = Jfield[0]->const_array(mfi);
-        Array4<Real const> const& Jy = Jfield[1]->const_array(mfi);
-        Array4<Real const> const& Jz = Jfield[2]->const_array(mfi);
-        Array4<Real const> const& Jix = Jifield[0]->const_array(mfi);
-        Array4<Real const> const& Jiy = Jifield[1]->const_array(mfi);
-        Array4<Real const> const& Jiz = Jifield[2]->const_array(mfi);
-        Array4<Real const> const& Bx = Bfield[0]->const_array(mfi);
-        Array4<Real const> const& By = Bfield[1]->const_array(mfi);
-        Array4<Real const> const& Bz = Bfield[2]->const_array(mfi);
+        Array4Triplet const J = {Jfield[0]->const_array(mfi), Jfield[1]->const_array(mfi), Jfield[2]->const_array(mfi)};
+        Array4Triplet const Ji = {Jifield[0]->const_array(mfi), Jifield[1]->const_array(mfi), Jifield[2]->const_array(mfi)};
+        Array4Triplet const B = {Bfield[0]->const_array(mfi), Bfield[1]->const_array(mfi), Bfield[2]->const_array(mfi)};
 
-        Array4<Real> Bx_ext, By_ext, Bz_ext;
+        Array4Triplet B_ext;
         if (include_external_fields) {
-            Bx_ext = Bfield_external[0]->array(mfi);
-            By_ext = Bfield_external[1]->array(mfi);
-            Bz_ext = Bfield_external[2]->array(mfi);
+            B_ext = {Bfield_external[0]->const_array(mfi), Bfield_external[1]->const_array(mfi), Bfield_external[2]->const_array(mfi)};
         }
 
         // Loop over the cells and update the nodal E field
         amrex::ParallelFor(mfi.tilebox(), [=] AMREX_GPU_DEVICE (int i, int j, int k){
-
-            // interpolate the total plasma current to a nodal grid
-            auto const jx_interp = Interp(Jx, Jx_stag, nodal, coarsen, i, j, k, 0);
-            auto const jy_interp = Interp(Jy, Jy_stag, nodal, coarsen, i, j, k, 0);
-            auto const jz_interp = Interp(Jz, Jz_stag, nodal, coarsen, i, j, k, 0);
-
-            // interpolate the ion current to a nodal grid
-            auto const jix_interp = Interp(Jix, Jx_stag, nodal, coarsen, i, j, k, 0);
-            auto const jiy_interp = Interp(Jiy, Jy_stag, nodal, coarsen, i, j, k, 0);
-            auto const jiz_interp = Interp(Jiz, Jz_stag, nodal, coarsen, i, j, k, 0);
-
-            // interpolate the B field to a nodal grid
-            auto Bx_interp = Interp(Bx, Bx_stag, nodal, coarsen, i, j, k, 0);
-            auto By_interp = Interp(By, By_stag, nodal, coarsen, i, j, k, 0);
-            auto Bz_interp = Interp(Bz, Bz_stag, nodal, coarsen, i, j, k, 0);
-
-            if (include_external_fields) {
-                Bx_interp += Interp(Bx_ext, Bx_stag, nodal, coarsen, i, j, k, 0);
-                By_interp += Interp(By_ext, By_stag, nodal, coarsen, i, j, k, 0);
-                Bz_interp += Interp(Bz_ext, Bz_stag, nodal, coarsen, i, j, k, 0);
-            }
-
-            // calculate enE = (J - Ji) x B
-            enE_nodal(i, j, k, 0) = (
-                (jy_interp - jiy_interp) * Bz_interp
-                - (jz_interp - jiz_interp) * By_interp
-            );
-            enE_nodal(i, j, k, 1) = (
-                (jz_interp - jiz_interp) * Bx_interp
-                - (jx_interp - jix_interp) * Bz_interp
-            );
-            enE_nodal(i, j, k, 2) = (
-                (jx_interp - jix_interp) * By_interp
-                - (jy_interp - jiy_interp) * Bx_interp
-            );
+            OhmsLawNodalJxB(i, j, k, enE_nodal, coefs, J, Ji, B, B_ext);
         });
 
         if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
@@ -1128,15 +1285,11 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
         Array4<Real> const& Ex = Efield[0]->array(mfi);
         Array4<Real> const& Ey = Efield[1]->array(mfi);
         Array4<Real> const& Ez = Efield[2]->array(mfi);
-        Array4<Real const> const& Jx = Jfield[0]->const_array(mfi);
-        Array4<Real const> const& Jy = Jfield[1]->const_array(mfi);
-        Array4<Real const> const& Jz = Jfield[2]->const_array(mfi);
+        Array4Triplet const J = {Jfield[0]->const_array(mfi), Jfield[1]->const_array(mfi), Jfield[2]->const_array(mfi)};
+        Array4Triplet const B = {Bfield[0]->const_array(mfi), Bfield[1]->const_array(mfi), Bfield[2]->const_array(mfi)};
         Array4<Real const> const& enE = enE_nodal_mf.const_array(mfi);
         Array4<Real const> const& rho = rhofield.const_array(mfi);
-        Array4<Real const> const& Pe = Pefield.array(mfi);
-        Array4<Real> const& Bx = Bfield[0]->array(mfi);
-        Array4<Real> const& By = Bfield[1]->array(mfi);
-        Array4<Real> const& Bz = Bfield[2]->array(mfi);
+        Array4<Real const> const& Pe = Pefield.const_array(mfi);
 
         // Extract structures indicating where the fields
         // should be updated, given the position of the embedded boundaries
@@ -1147,217 +1300,282 @@ void FiniteDifferenceSolver::HybridPICSolveECartesian (
             update_Ez_arr = eb_update_E[2]->array(mfi);
         }
 
-        Array4<Real> Ex_ext, Ey_ext, Ez_ext;
+        Array4<Real const> Ex_ext, Ey_ext, Ez_ext;
         if (include_external_fields) {
-            Ex_ext = Efield_external[0]->array(mfi);
-            Ey_ext = Efield_external[1]->array(mfi);
-            Ez_ext = Efield_external[2]->array(mfi);
+            Ex_ext = Efield_external[0]->const_array(mfi);
+            Ey_ext = Efield_external[1]->const_array(mfi);
+            Ez_ext = Efield_external[2]->const_array(mfi);
         }
 
-        // Extract stencil coefficients
-        Real const * const AMREX_RESTRICT coefs_x = m_stencil_coefs_x.dataPtr();
-        auto const n_coefs_x = static_cast<int>(m_stencil_coefs_x.size());
-        Real const * const AMREX_RESTRICT coefs_y = m_stencil_coefs_y.dataPtr();
-        auto const n_coefs_y = static_cast<int>(m_stencil_coefs_y.size());
-        Real const * const AMREX_RESTRICT coefs_z = m_stencil_coefs_z.dataPtr();
-        auto const n_coefs_z = static_cast<int>(m_stencil_coefs_z.size());
-
         Box const& tex  = mfi.tilebox(Efield[0]->ixType().toIntVect());
         Box const& tey  = mfi.tilebox(Efield[1]->ixType().toIntVect());
         Box const& tez  = mfi.tilebox(Efield[2]->ixType().toIntVect());
 
         // Loop over the cells and update the E field
-        // Ex calculation
-        amrex::ParallelFor(tex, [=] AMREX_GPU_DEVICE (int i, int j, int k){
+        amrex::ParallelFor(tex, tey, tez,
 
-            // Skip field update in the embedded boundaries
-            if (update_Ex_arr && update_Ex_arr(i, j, k) == 0) { return; }
+            // Ex calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                // Skip field update in the embedded boundaries
+                if (update_Ex_arr && update_Ex_arr(i, j, k) == 0) { return; }
 
-            // Interpolate to get the appropriate charge density in space
-            const Real rho_val = Interp(rho, nodal, Ex_stag, coarsen, i, j, k, 0);
+                Ex(i, j, k) = OhmsLawYeeE<T_Algo>(0, i, j, k, coefs, enE, rho, Pe, J, B,
+                                                  Ex_ext, solve_for_Faraday);
+            },
 
-            if (rho_val < rho_floor && holmstrom_vacuum_region) {
-                Ex(i, j, k) = 0._rt;
-            } else {
-                // Get the gradient of the electron pressure if the longitudinal part of
-                // the E-field should be included, otherwise ignore it since curl x (grad Pe) = 0
-                const Real grad_Pe = (!solve_for_Faraday) ?
-                    T_Algo::UpwardDx(Pe, coefs_x, n_coefs_x, i, j, k)
-                    : 0._rt;
+            // Ey calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                // Skip field update in the embedded boundaries
+                if (update_Ey_arr && update_Ey_arr(i, j, k) == 0) { return; }
 
-                // interpolate the nodal neE values to the Yee grid
-                const auto enE_x = Interp(enE, nodal, Ex_stag, coarsen, i, j, k, 0);
+                Ey(i, j, k) = OhmsLawYeeE<T_Algo>(1, i, j, k, coefs, enE, rho, Pe, J, B,
+                                                  Ey_ext, solve_for_Faraday);
+            },
 
-                // safety condition since we divide by rho
-                const auto rho_val_limited = std::max(rho_val, rho_floor);
+            // Ez calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                // Skip field update in the embedded boundaries
+                if (update_Ez_arr && update_Ez_arr(i, j, k) == 0) { return; }
 
-                Ex(i, j, k) = (enE_x - grad_Pe) / rho_val_limited;
+                Ez(i, j, k) = OhmsLawYeeE<T_Algo>(2, i, j, k, coefs, enE, rho, Pe, J, B,
+                                                  Ez_ext, solve_for_Faraday);
             }
+        );
 
-            // Add resistivity only if E field value is used to update B
-            if (solve_for_Faraday) {
-                Real jtot_val = 0._rt;
-                if (resistivity_has_J_dependence) {
-                    // Interpolate current to appropriate staggering to match E field
-                    const Real jx_val = Jx(i, j, k);
-                    const Real jy_val = Interp(Jy, Jy_stag, Ex_stag, coarsen, i, j, k, 0);
-                    const Real jz_val = Interp(Jz, Jz_stag, Ex_stag, coarsen, i, j, k, 0);
-                    jtot_val = std::sqrt(jx_val*jx_val + jy_val*jy_val + jz_val*jz_val);
-                }
+        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        {
+            amrex::Gpu::synchronize();
+            wt = static_cast<amrex::Real>(amrex::second()) - wt;
+            amrex::HostDevice::Atomic::Add( &(*cost)[mfi.index()], wt);
+        }
+    }
+}
 
-                Ex(i, j, k) += eta(rho_val, jtot_val, t_new) * Jx(i, j, k);
+template<typename T_Algo>
+void FiniteDifferenceSolver::HybridPICSolveEFusedCartesian (
+    ablastr::fields::VectorField const& Efield,
+    ablastr::fields::VectorField const& Jfield,
+    ablastr::fields::VectorField const& Jextfield,
+    ablastr::fields::VectorField const& Jifield,
+    ablastr::fields::VectorField const& Bfield,
+    amrex::MultiFab const& rhofield,
+    std::array< std::unique_ptr<amrex::iMultiFab>,3 > const& eb_update_E,
+    int lev, HybridPICModel const* hybrid_model )
+{
+    // for the profiler
+    amrex::LayoutData<amrex::Real>* cost = WarpX::getCosts(lev);
 
-                if (include_hyper_resistivity_term) {
+    // get hybrid model parameters
+    HybridOhmsLawCoefs const coefs = getHybridOhmsLawCoefs(
+        hybrid_model, lev, m_stencil_coefs_x, m_stencil_coefs_y, m_stencil_coefs_z);
+    const bool include_external_fields = coefs.include_external_fields;
+    const bool include_external_current = (Jextfield[0] != nullptr);
 
-                    // Interpolate B field to appropriate staggering to match E field
-                    Real btot_val = 0._rt;
-                    if (hyper_resistivity_has_B_dependence) {
-                        const Real bx_val = Interp(Bx, Bx_stag, Ex_stag, coarsen, i, j, k, 0);
-                        const Real by_val = Interp(By, By_stag, Ex_stag, coarsen, i, j, k, 0);
-                        const Real bz_val = Interp(Bz, Bz_stag, Ex_stag, coarsen, i, j, k, 0);
-                        btot_val = std::sqrt(bx_val*bx_val + by_val*by_val + bz_val*bz_val);
-                    }
+    auto & warpx = WarpX::GetInstance();
+    ablastr::fields::VectorField Bfield_external, Efield_external;
+    if (include_external_fields) {
+        Bfield_external = warpx.m_fields.get_alldirs(FieldType::hybrid_B_fp_external, 0); // lev=0
+        Efield_external = warpx.m_fields.get_alldirs(FieldType::hybrid_E_fp_external, 0); // lev=0
+    }
 
-                    auto nabla2Jx = T_Algo::Dxx(Jx, coefs_x, n_coefs_x, i, j, k)
-                        + T_Algo::Dyy(Jx, coefs_y, n_coefs_y, i, j, k)
-                        + T_Algo::Dzz(Jx, coefs_z, n_coefs_z, i, j, k);
+    Real const one_over_mu0 = 1._rt / PhysConst::mu0;
+
+    // The calculation is done tile by tile in 3 steps:
+    // 1) The plasma current J = curl x B / mu0 - J_ext is calculated on the
+    //    tile with one guard cell, into a tile-local buffer.
+    // 2) The J x B term is calculated on the nodes of the tile, into a
+    //    tile-local buffer, in order to ensure energy conservation.
+    // 3) The nodal values are averaged onto the Yee grid and the
+    //    resistivity terms are added.
+    // Steps 2 and 3 share their kernels with HybridPICSolveECartesian.
+    // The electron pressure term is not needed since curl x (grad Pe) = 0.
+    // Contrary to CalculatePlasmaCurrent followed by HybridPICSolveE, the
+    // plasma current and the nodal J x B term never leave the tile, which
+    // saves two sweeps over full MultiFabs at each substep. The valid region
+    // of the plasma current MultiFab is still updated for diagnostics.
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for ( MFIter mfi(*Efield[0], TilingIfNotGPU()); mfi.isValid(); ++mfi ) {
+        if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
+        {
+            amrex::Gpu::synchronize();
+        }
+        auto wt = static_cast<amrex::Real>(amrex::second());
 
-                    Ex(i, j, k) -= eta_h(rho_val, btot_val) * nabla2Jx;
-                }
-            }
+        // Extract field data for this grid/tile
+        Array4<Real> const& Ex = Efield[0]->array(mfi);
+        Array4<Real> const& Ey = Efield[1]->array(mfi);
+        Array4<Real> const& Ez = Efield[2]->array(mfi);
+        Array4<Real> const& Jx = Jfield[0]->array(mfi);
+        Array4<Real> const& Jy = Jfield[1]->array(mfi);
+        Array4<Real> const& Jz = Jfield[2]->array(mfi);
+        Array4<Real const> const& Bx = Bfield[0]->const_array(mfi);
+        Array4<Real const> const& By = Bfield[1]->const_array(mfi);
+        Array4<Real const> const& Bz = Bfield[2]->const_array(mfi);
+        Array4Triplet const Ji = {Jifield[0]->const_array(mfi), Jifield[1]->const_array(mfi), Jifield[2]->const_array(mfi)};
+        Array4Triplet const B = {Bx, By, Bz};
+        Array4<Real const> const& rho = rhofield.const_array(mfi);
 
-            if (include_external_fields && (rho_val >= rho_floor)) {
-                Ex(i, j, k) -= Ex_ext(i, j, k);
-            }
-        });
+        Array4<Real const> Jx_ext, Jy_ext, Jz_ext;
+        if (include_external_current) {
+            Jx_ext = Jextfield[0]->const_array(mfi);
+            Jy_ext = Jextfield[1]->const_array(mfi);
+            Jz_ext = Jextfield[2]->const_array(mfi);
+        }
 
-        // Ey calculation
-        amrex::ParallelFor(tey, [=] AMREX_GPU_DEVICE (int i, int j, int k) {
+        Array4Triplet B_ext;
+        Array4<Real const> Ex_ext, Ey_ext, Ez_ext;
+        if (include_external_fields) {
+            B_ext = {Bfield_external[0]->const_array(mfi), Bfield_external[1]->const_array(mfi), Bfield_external[2]->const_array(mfi)};
+            Ex_ext = Efield_external[0]->const_array(mfi);
+            Ey_ext = Efield_external[1]->const_array(mfi);
+            Ez_ext = Efield_external[2]->const_array(mfi);
+        }
 
-            // Skip field update in the embedded boundaries
-            if (update_Ey_arr && update_Ey_arr(i, j, k) == 0) { return; }
+        // Extract structures indicating where the fields
+        // should be updated, given the position of the embedded boundaries.
+        // The plasma current is stored at the same locations as the E-field,
+        // therefore the `eb_update_E` multifab also appropriately specifies
+        // where the plasma current should be calculated.
+        amrex::Array4<int> update_Ex_arr, update_Ey_arr, update_Ez_arr;
+        if (EB::enabled()) {
+            update_Ex_arr = eb_update_E[0]->array(mfi);
+            update_Ey_arr = eb_update_E[1]->array(mfi);
+            update_Ez_arr = eb_update_E[2]->array(mfi);
+        }
 
-            // Interpolate to get the appropriate charge density in space
-            const Real rho_val = Interp(rho, nodal, Ey_stag, coarsen, i, j, k, 0);
+        // Extract stencil coefficients
+        Real const * const AMREX_RESTRICT coefs_x = coefs.coefs_x;
+        auto const n_coefs_x = coefs.n_coefs_x;
+        Real const * const AMREX_RESTRICT coefs_y = coefs.coefs_y;
+        auto const n_coefs_y = coefs.n_coefs_y;
+        Real const * const AMREX_RESTRICT coefs_z = coefs.coefs_z;
+        auto const n_coefs_z = coefs.n_coefs_z;
+
+        // Cell-centered tilebox, from which the local buffers are defined
+        Box const& tbx = mfi.tilebox(IntVect::TheCellVector());
+
+        // Tileboxes owned by this tile, for the plasma current and E-field
+        Box const& tjx = mfi.tilebox(Jfield[0]->ixType().toIntVect());
+        Box const& tjy = mfi.tilebox(Jfield[1]->ixType().toIntVect());
+        Box const& tjz = mfi.tilebox(Jfield[2]->ixType().toIntVect());
+        Box const& tex = mfi.tilebox(Efield[0]->ixType().toIntVect());
+        Box const& tey = mfi.tilebox(Efield[1]->ixType().toIntVect());
+        Box const& tez = mfi.tilebox(Efield[2]->ixType().toIntVect());
+
+        // Tile-local plasma current, with one guard cell for the nodal
+        // interpolation and the hyper-resistivity Laplacian
+        Box const gjx = amrex::grow(amrex::convert(tbx, Jfield[0]->ixType()), 1);
+        Box const gjy = amrex::grow(amrex::convert(tbx, Jfield[1]->ixType()), 1);
+        Box const gjz = amrex::grow(amrex::convert(tbx, Jfield[2]->ixType()), 1);
+        FArrayBox jx_fab(gjx, 1, amrex::The_Async_Arena());
+        FArrayBox jy_fab(gjy, 1, amrex::The_Async_Arena());
+        FArrayBox jz_fab(gjz, 1, amrex::The_Async_Arena());
+        Array4<Real> const& jx_loc = jx_fab.array();
+        Array4<Real> const& jy_loc = jy_fab.array();
+        Array4<Real> const& jz_loc = jz_fab.array();
+        Array4Triplet const J_loc = {jx_fab.const_array(), jy_fab.const_array(), jz_fab.const_array()};
+
+        // Tile-local nodal J x B term, on all the nodes surrounding the tile
+        Box const nbx = amrex::surroundingNodes(tbx);
+        FArrayBox enE_fab(nbx, 3, amrex::The_Async_Arena());
+        Array4<Real> const& enE = enE_fab.array();
+        Array4<Real const> const& enE_const = enE_fab.const_array();
+
+        // Step 1: calculate the plasma current, using Ampere's law, on the
+        // same grid as the E-field
+        amrex::ParallelFor(gjx, gjy, gjz,
 
-            if (rho_val < rho_floor && holmstrom_vacuum_region) {
-                Ey(i, j, k) = 0._rt;
-            } else {
-                // Get the gradient of the electron pressure if the longitudinal part of
-                // the E-field should be included, otherwise ignore it since curl x (grad Pe) = 0
-                const Real grad_Pe = (!solve_for_Faraday) ?
-                    T_Algo::UpwardDy(Pe, coefs_y, n_coefs_y, i, j, k)
-                    : 0._rt;
+            // Jx calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
-                // interpolate the nodal neE values to the Yee grid
-                const auto enE_y = Interp(enE, nodal, Ey_stag, coarsen, i, j, k, 1);
+                // Skip field update in the embedded boundaries
+                if (update_Ex_arr && update_Ex_arr(i, j, k) == 0) {
+                    jx_loc(i, j, k) = Jx(i, j, k);
+                    return;
+                }
 
-                // safety condition since we divide by rho
-                const auto rho_val_limited = std::max(rho_val, rho_floor);
+                jx_loc(i, j, k) = one_over_mu0 * (
+                    - T_Algo::DownwardDz(By, coefs_z, n_coefs_z, i, j, k)
+                    + T_Algo::DownwardDy(Bz, coefs_y, n_coefs_y, i, j, k)
+                );
+                if (include_external_current) { jx_loc(i, j, k) -= Jx_ext(i, j, k); }
+                if (tjx.contains(IntVect(AMREX_D_DECL(i, j, k)))) { Jx(i, j, k) = jx_loc(i, j, k); }
+            },
 
-                Ey(i, j, k) = (enE_y - grad_Pe) / rho_val_limited;
-            }
+            // Jy calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
-            // Add resistivity only if E field value is used to update B
-            if (solve_for_Faraday) {
-                Real jtot_val = 0._rt;
-                if (resistivity_has_J_dependence) {
-                    // Interpolate current to appropriate staggering to match E field
-                    const Real jx_val = Interp(Jx, Jx_stag, Ey_stag, coarsen, i, j, k, 0);
-                    const Real jy_val = Jy(i, j, k);
-                    const Real jz_val = Interp(Jz, Jz_stag, Ey_stag, coarsen, i, j, k, 0);
-                    jtot_val = std::sqrt(jx_val*jx_val + jy_val*jy_val + jz_val*jz_val);
+                // Skip field update in the embedded boundaries
+                if (update_Ey_arr && update_Ey_arr(i, j, k) == 0) {
+                    jy_loc(i, j, k) = Jy(i, j, k);
+                    return;
                 }
 
-                Ey(i, j, k) += eta(rho_val, jtot_val, t_new) * Jy(i, j, k);
-
-                if (include_hyper_resistivity_term) {
-
-                    // Interpolate B field to appropriate staggering to match E field
-                    Real btot_val = 0._rt;
-                    if (hyper_resistivity_has_B_dependence) {
-                        const Real bx_val = Interp(Bx, Bx_stag, Ey_stag, coarsen, i, j, k, 0);
-                        const Real by_val = Interp(By, By_stag, Ey_stag, coarsen, i, j, k, 0);
-                        const Real bz_val = Interp(Bz, Bz_stag, Ey_stag, coarsen, i, j, k, 0);
-                        btot_val = std::sqrt(bx_val*bx_val + by_val*by_val + bz_val*bz_val);
-                    }
+                jy_loc(i, j, k) = one_over_mu0 * (
+                    - T_Algo::DownwardDx(Bz, coefs_x, n_coefs_x, i, j, k)
+                    + T_Algo::DownwardDz(Bx, coefs_z, n_coefs_z, i, j, k)
+                );
+                if (include_external_current) { jy_loc(i, j, k) -= Jy_ext(i, j, k); }
+                if (tjy.contains(IntVect(AMREX_D_DECL(i, j, k)))) { Jy(i, j, k) = jy_loc(i, j, k); }
+            },
 
-                    auto nabla2Jy = T_Algo::Dxx(Jy, coefs_x, n_coefs_x, i, j, k)
-                        + T_Algo::Dyy(Jy, coefs_y, n_coefs_y, i, j, k)
-                        + T_Algo::Dzz(Jy, coefs_z, n_coefs_z, i, j, k);
+            // Jz calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
 
-                    Ey(i, j, k) -= eta_h(rho_val, btot_val) * nabla2Jy;
+                // Skip field update in the embedded boundaries
+                if (update_Ez_arr && update_Ez_arr(i, j, k) == 0) {
+                    jz_loc(i, j, k) = Jz(i, j, k);
+                    return;
                 }
-            }
 
-            if (include_external_fields && (rho_val >= rho_floor)) {
-                Ey(i, j, k) -= Ey_ext(i, j, k);
+                jz_loc(i, j, k) = one_over_mu0 * (
+                    - T_Algo::DownwardDy(Bx, coefs_y, n_coefs_y, i, j, k)
+                    + T_Algo::DownwardDx(By, coefs_x, n_coefs_x, i, j, k)
+                );
+                if (include_external_current) { jz_loc(i, j, k) -= Jz_ext(i, j, k); }
+                if (tjz.contains(IntVect(AMREX_D_DECL(i, j, k)))) { Jz(i, j, k) = jz_loc(i, j, k); }
             }
-        });
-
-        // Ez calculation
-        amrex::ParallelFor(tez, [=] AMREX_GPU_DEVICE (int i, int j, int k){
-
-            // Skip field update in the embedded boundaries
-            if (update_Ez_arr && update_Ez_arr(i, j, k) == 0) { return; }
-
-            // Interpolate to get the appropriate charge density in space
-            const Real rho_val = Interp(rho, nodal, Ez_stag, coarsen, i, j, k, 0);
-
-            if (rho_val < rho_floor && holmstrom_vacuum_region) {
-                Ez(i, j, k) = 0._rt;
-            } else {
-                // Get the gradient of the electron pressure if the longitudinal part of
-                // the E-field should be included, otherwise ignore it since curl x (grad Pe) = 0
-                const Real grad_Pe = (!solve_for_Faraday) ?
-                    T_Algo::UpwardDz(Pe, coefs_z, n_coefs_z, i, j, k)
-                    : 0._rt;
-
-                // interpolate the nodal neE values to the Yee grid
-                const auto enE_z = Interp(enE, nodal, Ez_stag, coarsen, i, j, k, 2);
-
-                // safety condition since we divide by rho
-                const auto rho_val_limited = std::max(rho_val, rho_floor);
+        );
 
-                Ez(i, j, k) = (enE_z - grad_Pe) / rho_val_limited;
-            }
+        // Step 2: calculate enE = (J - Ji) x B on the nodes of the tile
+        amrex::ParallelFor(nbx, [=] AMREX_GPU_DEVICE (int i, int j, int k){
+            OhmsLawNodalJxB(i, j, k, enE, coefs, J_loc, Ji, B, B_ext);
+        });
 
-            // Add resistivity only if E field value is used to update B
-            if (solve_for_Faraday) {
-                Real jtot_val = 0._rt;
-                if (resistivity_has_J_dependence) {
-                    // Interpolate current to appropriate staggering to match E field
-                    const Real jx_val = Interp(Jx, Jx_stag, Ez_stag, coarsen, i, j, k, 0);
-                    const Real jy_val = Interp(Jy, Jy_stag, Ez_stag, coarsen, i, j, k, 0);
-                    const Real jz_val = Jz(i, j, k);
-                    jtot_val = std::sqrt(jx_val*jx_val + jy_val*jy_val + jz_val*jz_val);
-                }
+        // Step 3: update the E field on the Yee grid (with the resistivity
+        // terms, as the E-field is used to update B)
+        Array4<Real const> const no_Pe;
+        amrex::ParallelFor(tex, tey, tez,
 
-                Ez(i, j, k) += eta(rho_val, jtot_val, t_new) * Jz(i, j, k);
+            // Ex calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                // Skip field update in the embedded boundaries
+                if (update_Ex_arr && update_Ex_arr(i, j, k) == 0) { return; }
 
-                if (include_hyper_resistivity_term) {
+                Ex(i, j, k) = OhmsLawYeeE<T_Algo>(0, i, j, k, coefs, enE_const, rho, no_Pe,
+                                                  J_loc, B, Ex_ext, true);
+            },
 
-                    // Interpolate B field to appropriate staggering to match E field
-                    Real btot_val = 0._rt;
-                    if (hyper_resistivity_has_B_dependence) {
-                        const Real bx_val = Interp(Bx, Bx_stag, Ez_stag, coarsen, i, j, k, 0);
-                        const Real by_val = Interp(By, By_stag, Ez_stag, coarsen, i, j, k, 0);
-                        const Real bz_val = Interp(Bz, Bz_stag, Ez_stag, coarsen, i, j, k, 0);
-                        btot_val = std::sqrt(bx_val*bx_val + by_val*by_val + bz_val*bz_val);
-                    }
+            // Ey calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                // Skip field update in the embedded boundaries
+                if (update_Ey_arr && update_Ey_arr(i, j, k) == 0) { return; }
 
-                    auto nabla2Jz = T_Algo::Dxx(Jz, coefs_x, n_coefs_x, i, j, k)
-                        + T_Algo::Dyy(Jz, coefs_y, n_coefs_y, i, j, k)
-                        + T_Algo::Dzz(Jz, coefs_z, n_coefs_z, i, j, k);
+                Ey(i, j, k) = OhmsLawYeeE<T_Algo>(1, i, j, k, coefs, enE_const, rho, no_Pe,
+                                                  J_loc, B, Ey_ext, true);
+            },
 
-                    Ez(i, j, k) -= eta_h(rho_val, btot_val) * nabla2Jz;
-                }
-            }
+            // Ez calculation
+            [=] AMREX_GPU_DEVICE (int i, int j, int k){
+                // Skip field update in the embedded boundaries
+                if (update_Ez_arr && update_Ez_arr(i, j, k) == 0) { return; }
 
-            if (include_external_fields && (rho_val >= rho_floor)) {
-                Ez(i, j, k) -= Ez_ext(i, j, k);
+                Ez(i, j, k) = OhmsLawYeeE<T_Algo>(2, i, j, k, coefs, enE_const, rho, no_Pe,
+                                                  J_loc, B, Ez_ext, true);
             }
-        });
+        );
 
         if (cost && WarpX::load_balance_costs_update_algo == LoadBalanceCostsUpdateAlgo::Timers)
         {
@@ -529,6 +529,9 @@ void ImplicitSolver::parseNonlinearSolverParams ( const amrex::ParmParse&  pp )
         }
         pp.query("max_particle_iterations", m_max_particle_iterations);
         pp.query("particle_tolerance", m_particle_tolerance);
+        pp.query("particle_fast_pass_iterations", m_particle_fast_pass_iterations);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_particle_fast_pass_iterations >= 0,
+            "implicit_evolve.particle_fast_pass_iterations must be >= 0");
         pp.query("particle_suborbits", m_particle_suborbits);
         pp.query("print_unconverged_particle_details", m_print_unconverged_particle_details);
         pp.query("use_mass_matrices_jacobian", m_use_mass_matrices_jacobian);
@@ -871,6 +874,7 @@ void ImplicitSolver::PreRHSOp ( const amrex::Real  a_cur_time,
     }
     else {
         options.max_particle_iterations = m_max_particle_iterations;
+        options.particle_fast_pass_iterations = m_particle_fast_pass_iterations;
         options.particle_tolerance = m_particle_tolerance;
     }
 
@@ -1216,6 +1220,7 @@ void ImplicitSolver::PrintBaseImplicitSolverParameters () const
 {
     amrex::Print() << "max particle iterations:             " << m_max_particle_iterations << "\n";
     amrex::Print() << "particle relative tolerance:         " << m_particle_tolerance << "\n";
+    amrex::Print() << "particle fast pass iterations:       " << m_particle_fast_pass_iterations << "\n";
     amrex::Print() << "use particle suborbits:              " << (m_particle_suborbits ? "true":"false") << "\n";
     amrex::Print() << "print unconverged particle details:  " << (m_print_unconverged_particle_details ? "true":"false") << "\n";
     amrex::Print() << "Nonlinear solver type:               " << amrex::getEnumNameString(m_nlsolver_type) << "\n";
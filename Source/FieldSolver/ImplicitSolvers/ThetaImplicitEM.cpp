@@ -62,7 +62,8 @@ void ThetaImplicitEM::Define (WarpX* const a_WarpX, bool a_from_restart)
     if (m_use_mass_matrices) { InitializeMassMatrices(); }
 
     const PreconditionerType pc_type = m_nlsolver->GetPreconditionerType();
-    if (pc_type == PreconditionerType::pc_petsc) { InitializeCurlCurlBCMasks(); }
+    if (pc_type == PreconditionerType::pc_petsc ||
+        pc_type == PreconditionerType::pc_matrix) { InitializeCurlCurlBCMasks(); }
 
     m_is_defined = true;
 
@@ -335,6 +335,8 @@ WarpX::ImplicitComputeRHSE (int lev, PatchType patch_type, amrex::Real a_dt, War
                                         patch_type,
                                         a_Erhs_vec.getArrayVec()[lev],
                                         m_eb_update_E[lev],
+                                        GetEBNoUpdateEBoxes(lev),
+                                        nullptr,
                                         a_dt );
     } else {
         m_fdtd_solver_cp[lev]->EvolveE( m_fields,
@@ -342,6 +344,8 @@ WarpX::ImplicitComputeRHSE (int lev, PatchType patch_type, amrex::Real a_dt, War
                                         patch_type,
                                         a_Erhs_vec.getArrayVec()[lev],
                                         m_eb_update_E[lev],
+                                        GetEBNoUpdateEBoxes(lev),
+                                        nullptr,
                                         a_dt );
     }
 
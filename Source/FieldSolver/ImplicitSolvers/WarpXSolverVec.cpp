@@ -7,6 +7,10 @@
 #include "FieldSolver/ImplicitSolvers/WarpXSolverVec.H"
 #include "WarpX.H"
 
+#include <AMReX_GpuBuffer.H>
+#include <AMReX_MFParallelFor.H>
+#include <AMReX_ParallelReduce.H>
+
 using warpx::fields::FieldType;
 std::unique_ptr<WarpXSolverDOF> WarpXSolverVec::m_dofs = nullptr;
 
@@ -239,7 +243,77 @@ void WarpXSolverVec::copyTo ( amrex::Real* const a_arr) const
     }
 }
 
+void WarpXSolverVec::multiIncrement ( const amrex::Vector<const WarpXSolverVec*>&  a_X,
+                                      const amrex::Real*  a_a )
+{
+    BL_PROFILE("WarpXSolverVec::multiIncrement");
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        IsDefined(),
+        "WarpXSolverVec::multiIncrement() called on undefined WarpXSolverVec");
+    const int nvecs = static_cast<int>(a_X.size());
+    if (nvecs == 0) { return; }
+    for (const auto* X : a_X) {
+        assertIsDefined( *X );
+        assertSameType( *X );
+    }
+
+    const amrex::Gpu::Buffer<amrex::Real> coeffs(a_a, nvecs);
+    const auto* coeffs_ptr = coeffs.data();
+
+    // Y += sum_v a[v]*X[v] over the valid cells of all boxes, in one kernel
+    auto fused_increment = [&] ( amrex::MultiFab& a_Y,
+                                 const amrex::Vector<const amrex::MultiFab*>& a_Xmf )
+    {
+        amrex::Vector<amrex::MultiArray4<const amrex::Real>> h_xs;
+        for (const auto* mf : a_Xmf) { h_xs.push_back(mf->const_arrays()); }
+        const amrex::Gpu::Buffer<amrex::MultiArray4<const amrex::Real>> xs(h_xs.data(), h_xs.size());
+        const auto* xs_ptr = xs.data();
+        const auto& ys = a_Y.arrays();
+        amrex::ParallelFor( a_Y, [=] AMREX_GPU_DEVICE (int b, int i, int j, int k)
+        {
+            amrex::Real sum = 0.0;
+            for (int v = 0; v < nvecs; v++) {
+                sum += coeffs_ptr[v]*xs_ptr[v][b](i,j,k);
+            }
+            ys[b](i,j,k) += sum;
+        });
+        amrex::Gpu::streamSynchronize();
+    };
+
+    amrex::Vector<const amrex::MultiFab*> Xmf(nvecs);
+    for (int lev = 0; lev < m_num_amr_levels; ++lev) {
+        if (m_array_type != FieldType::None) {
+            for (int n = 0; n < 3; ++n) {
+                for (int v = 0; v < nvecs; v++) { Xmf[v] = a_X[v]->getArrayVec()[lev][n]; }
+                fused_increment( *m_array_vec[lev][n], Xmf );
+            }
+        }
+        if (m_scalar_type != FieldType::None) {
+            for (int v = 0; v < nvecs; v++) { Xmf[v] = a_X[v]->getScalarVec()[lev]; }
+            fused_increment( *m_scalar_vec[lev], Xmf );
+        }
+    }
+}
+
 [[nodiscard]] amrex::Real WarpXSolverVec::dotProduct ( const WarpXSolverVec&  a_X ) const
+{
+    amrex::Real result = localDotProduct( a_X );
+    amrex::ParallelAllReduce::Sum(result, amrex::ParallelContext::CommunicatorSub());
+    return result;
+}
+
+void WarpXSolverVec::multiDotProduct ( const amrex::Vector<const WarpXSolverVec*>&  a_X,
+                                       amrex::Real*  a_result ) const
+{
+    BL_PROFILE("WarpXSolverVec::multiDotProduct");
+    const int nvecs = static_cast<int>(a_X.size());
+    for (int v = 0; v < nvecs; v++) {
+        a_result[v] = localDotProduct( *a_X[v] );
+    }
+    amrex::ParallelAllReduce::Sum(a_result, nvecs, amrex::ParallelContext::CommunicatorSub());
+}
+
+[[nodiscard]] amrex::Real WarpXSolverVec::localDotProduct ( const WarpXSolverVec&  a_X ) const
 {
     assertIsDefined( a_X );
     assertSameType( a_X );
@@ -264,6 +338,5 @@ void WarpXSolverVec::copyTo ( amrex::Real* const a_arr) const
             result += rtmp;
         }
     }
-    amrex::ParallelAllReduce::Sum(result, amrex::ParallelContext::CommunicatorSub());
     return result;
 }
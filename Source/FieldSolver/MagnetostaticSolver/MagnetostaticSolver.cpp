@@ -44,6 +44,8 @@
 #include <AMReX_MFIter.H>
 #include <AMReX_MLMG.H>
 #include <AMReX_MultiFab.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParReduce.H>
 #include <AMReX_REAL.H>
 #include <AMReX_SPACE.H>
 #include <AMReX_Vector.H>
@@ -52,7 +54,9 @@
 #   include <AMReX_EBFabFactory.H>
 #endif
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <memory>
 #include <string>
 
@@ -119,6 +123,30 @@ WarpX::AddMagnetostaticFieldLabFrame()
 
     SyncCurrent("current_fp");
 
+    // Reuse the magnetic field of the last solve if the current density
+    // did not change significantly since then
+    auto& state = m_magnetostatic_solver_state;
+    const bool do_skip_solves = magnetostatic_solver_skip_tolerance > 0._rt;
+    if (do_skip_solves) {
+        const ablastr::fields::MultiLevelVectorField current_fp =
+            m_fields.get_mr_levels_alldirs(FieldType::current_fp, finest_level);
+        if (state.n_skipped < magnetostatic_solver_max_skipped_solves &&
+            state.currentIsUnchanged(current_fp, magnetostatic_solver_skip_tolerance))
+        {
+            for (int lev = 0; lev <= finest_level; lev++) {
+                for (int dim=0; dim < 3; dim++) {
+                    MultiFab::Add(*m_fields.get(FieldType::Bfield_fp, Direction{dim}, lev),
+                                  *state.B_last_solve[lev][dim], 0, 0, 1, 0);
+                }
+            }
+            ++state.n_skipped;
+            return;
+        }
+        state.storeCurrent(current_fp,
+            m_fields.get_mr_levels_alldirs(FieldType::Bfield_fp, finest_level));
+        state.n_skipped = 0;
+    }
+
     // set the boundary and current density potentials
     setVectorPotentialBC(m_fields.get_mr_levels_alldirs(FieldType::vector_potential_fp_nodal, finest_level));
 
@@ -132,6 +160,16 @@ WarpX::AddMagnetostaticFieldLabFrame()
         magnetostatic_solver_required_precision, magnetostatic_solver_absolute_tolerance,
         magnetostatic_solver_max_iters, magnetostatic_solver_verbosity
     );
+
+    // Add the magnetic field of this solve, which was stored separately
+    if (do_skip_solves) {
+        for (int lev = 0; lev <= finest_level; lev++) {
+            for (int dim=0; dim < 3; dim++) {
+                MultiFab::Add(*m_fields.get(FieldType::Bfield_fp, Direction{dim}, lev),
+                              *state.B_last_solve[lev][dim], 0, 0, 1, 0);
+            }
+        }
+    }
 }
 
 /* Compute the vector potential `A` by solving the Poisson equation with `J` as
@@ -173,7 +211,18 @@ WarpX::computeVectorPotential (ablastr::fields::MultiLevelVectorField const& cur
                                                                  A[lev][2]}));
     }
 
-    const ablastr::fields::MultiLevelVectorField Bfield_fp = m_fields.get_mr_levels_alldirs(FieldType::Bfield_fp, finest_level);
+    // When solves may be skipped, the magnetic field of this solve is kept
+    // in a separate buffer, which is then added to Bfield_fp by the caller
+    ablastr::fields::MultiLevelVectorField Bfield_fp = m_fields.get_mr_levels_alldirs(FieldType::Bfield_fp, finest_level);
+    if (magnetostatic_solver_skip_tolerance > 0._rt) {
+        auto& B_last_solve = m_magnetostatic_solver_state.B_last_solve;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            for (int dim = 0; dim < 3; ++dim) {
+                B_last_solve[lev][dim]->setVal(0._rt);
+                Bfield_fp[lev][dim] = B_last_solve[lev][dim].get();
+            }
+        }
+    }
     const std::optional<MagnetostaticSolver::EBCalcBfromVectorPotentialPerLevel> post_A_calculation(
     {
         Bfield_fp,
@@ -196,6 +245,8 @@ WarpX::computeVectorPotential (ablastr::fields::MultiLevelVectorField const& cur
     const std::optional<amrex::Vector<amrex::FArrayBoxFactory const *> > eb_farray_box_factory;
 #endif
 
+    m_magnetostatic_solver_state.poisson_state->reuse_solver = magnetostatic_solver_reuse_solver;
+
     ablastr::fields::computeVectorPotential(
         sorted_curr,
         sorted_A,
@@ -212,7 +263,8 @@ WarpX::computeVectorPotential (ablastr::fields::MultiLevelVectorField const& cur
         this->ref_ratio,
         post_A_calculation,
         gett_new(0),
-        eb_farray_box_factory
+        eb_farray_box_factory,
+        m_magnetostatic_solver_state.poisson_state.get()
     );
 
 }
@@ -375,6 +427,78 @@ void MagnetostaticSolver::VectorPoissonBoundaryHandler::defineVectorPotentialBCs
     bcs_set = true;
 }
 
+MagnetostaticSolver::MagnetostaticSolverState::MagnetostaticSolverState ()
+    : poisson_state{std::make_unique<ablastr::fields::VectorPoissonSolverState>()}
+{}
+
+MagnetostaticSolver::MagnetostaticSolverState::~MagnetostaticSolverState () = default;
+
+bool
+MagnetostaticSolver::MagnetostaticSolverState::currentIsUnchanged (
+    ablastr::fields::MultiLevelVectorField const& J,
+    amrex::Real tolerance) const
+{
+    if (J_last_solve.size() != J.size()) { return false; }
+
+    amrex::Real max_diff = 0._rt;
+    amrex::Real max_J = 0._rt;
+    for (int lev = 0; lev < static_cast<int>(J.size()); ++lev) {
+        for (int dim = 0; dim < 3; ++dim) {
+            amrex::MultiFab const* const J_last = J_last_solve[lev][dim].get();
+            amrex::MultiFab const* const J_new = J[lev][dim];
+            // The grids changed (e.g. after load balancing): a new solve is needed
+            if (!J_last || J_last->boxArray() != J_new->boxArray() ||
+                J_last->DistributionMap() != J_new->DistributionMap()) {
+                return false;
+            }
+
+            auto const& J_new_arr = J_new->const_arrays();
+            auto const& J_last_arr = J_last->const_arrays();
+            auto const diff = amrex::ParReduce(amrex::TypeList<amrex::ReduceOpMax>{},
+                                               amrex::TypeList<amrex::Real>{},
+                                               *J_new, amrex::IntVect(0),
+                [=] AMREX_GPU_DEVICE (int b, int i, int j, int k) noexcept
+                    -> amrex::GpuTuple<amrex::Real>
+                {
+                    return { std::abs(J_new_arr[b](i,j,k) - J_last_arr[b](i,j,k)) };
+                });
+            max_diff = std::max(max_diff, amrex::get<0>(diff));
+            max_J = std::max(max_J, J_last->norm0(0, 0, true));
+        }
+    }
+    amrex::ParallelDescriptor::ReduceRealMax({max_diff, max_J});
+
+    return max_diff <= tolerance * max_J;
+}
+
+void
+MagnetostaticSolver::MagnetostaticSolverState::storeCurrent (
+    ablastr::fields::MultiLevelVectorField const& J,
+    ablastr::fields::MultiLevelVectorField const& B)
+{
+    auto const nlevs = static_cast<int>(J.size());
+    J_last_solve.resize(nlevs);
+    B_last_solve.resize(nlevs);
+    for (int lev = 0; lev < nlevs; ++lev) {
+        for (int dim = 0; dim < 3; ++dim) {
+            auto& J_last = J_last_solve[lev][dim];
+            if (!J_last || J_last->boxArray() != J[lev][dim]->boxArray() ||
+                J_last->DistributionMap() != J[lev][dim]->DistributionMap()) {
+                J_last = std::make_unique<amrex::MultiFab>(
+                    J[lev][dim]->boxArray(), J[lev][dim]->DistributionMap(), 1, 0);
+            }
+            amrex::MultiFab::Copy(*J_last, *J[lev][dim], 0, 0, 1, 0);
+
+            auto& B_last = B_last_solve[lev][dim];
+            if (!B_last || B_last->boxArray() != B[lev][dim]->boxArray() ||
+                B_last->DistributionMap() != B[lev][dim]->DistributionMap()) {
+                B_last = std::make_unique<amrex::MultiFab>(
+                    B[lev][dim]->boxArray(), B[lev][dim]->DistributionMap(), 1, 0);
+            }
+        }
+    }
+}
+
 void MagnetostaticSolver::EBCalcBfromVectorPotentialPerLevel::doInterp (amrex::MultiFab & src,
                                                                         amrex::MultiFab & dst)
 {
@@ -972,12 +972,14 @@ WarpX::EvolveB (int lev, PatchType patch_type, amrex::Real a_dt, SubcyclingHalf
         m_fdtd_solver_fp[lev]->EvolveB( m_fields,
                                         lev,
                                         patch_type,
-                                        m_flag_info_face[lev], m_borrowing[lev], a_dt );
+                                        m_flag_info_face[lev], m_borrowing[lev],
+                                        GetFrozenBoxes(lev), a_dt );
     } else {
         m_fdtd_solver_cp[lev]->EvolveB( m_fields,
                                         lev,
                                         patch_type,
-                                        m_flag_info_face[lev], m_borrowing[lev], a_dt );
+                                        m_flag_info_face[lev], m_borrowing[lev],
+                                        nullptr, a_dt );
     }
 
     // Evolve B field in PML cells
@@ -1029,6 +1031,8 @@ WarpX::EvolveE (int lev, PatchType patch_type, amrex::Real a_dt, amrex::Real sta
                                         patch_type,
                                         m_fields.get_alldirs(FieldType::Efield_fp, lev),
                                         m_eb_update_E[lev],
+                                        GetEBNoUpdateEBoxes(lev),
+                                        GetFrozenBoxes(lev),
                                         a_dt );
     } else {
         m_fdtd_solver_cp[lev]->EvolveE( m_fields,
@@ -1036,6 +1040,8 @@ WarpX::EvolveE (int lev, PatchType patch_type, amrex::Real a_dt, amrex::Real sta
                                         patch_type,
                                         m_fields.get_alldirs(FieldType::Efield_cp, lev),
                                         m_eb_update_E[lev],
+                                        GetEBNoUpdateEBoxes(lev),
+                                        nullptr,
                                         a_dt );
     }
 
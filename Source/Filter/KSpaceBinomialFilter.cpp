@@ -0,0 +1,116 @@
+/* Copyright 2025 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "KSpaceBinomialFilter.H"
+
+#include "Utils/WarpXConst.H"
+
+#include <ablastr/profiler/ProfilerWrapper.H>
+
+#include <AMReX_Array4.H>
+#include <AMReX_BoxArray.H>
+#include <AMReX_GpuComplex.H>
+#include <AMReX_GpuLaunch.H>
+#include <AMReX_MFIter.H>
+#include <AMReX_Periodicity.H>
+
+#include <cmath>
+
+using namespace amrex::literals;
+
+KSpaceBinomialFilter::KSpaceBinomialFilter (amrex::IntVect const& npass_each_dir,
+                                            bool const compensation)
+    : m_npass_each_dir{npass_each_dir}, m_compensation{compensation}
+{}
+
+void
+KSpaceBinomialFilter::Setup (amrex::Box const& domain)
+{
+    m_domain = domain;
+    m_r2c = std::make_unique<amrex::FFT::R2C<amrex::Real>>(domain);
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        int const n = domain.length(idim);
+        int const npass = m_npass_each_dir[idim];
+        bool const compensation = m_compensation;
+        m_filter[idim].resize(n);
+        amrex::Real* p_filter = m_filter[idim].data();
+        amrex::ParallelFor(n, [=] AMREX_GPU_DEVICE (int m) noexcept
+        {
+            // k*dx/2 = pi*m/n; sin^2 is the same for m and n-m (negative k)
+            amrex::Real const ss = std::sin(MathConst::pi*m/n);
+            amrex::Real const ss2 = ss*ss;
+            auto filt = static_cast<amrex::Real>(std::pow(1._rt - ss2, npass));
+            if (compensation) {
+                filt *= (1._rt + npass*ss2);
+            }
+            p_filter[m] = filt;
+        });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+void
+KSpaceBinomialFilter::Apply (amrex::MultiFab& mf, amrex::Box const& domain)
+{
+    ABLASTR_PROFILE("KSpaceBinomialFilter::Apply()");
+
+    if (!m_r2c || domain != m_domain) { Setup(domain); }
+
+    amrex::BoxArray const cba = amrex::convert(mf.boxArray(), amrex::IntVect::TheCellVector());
+    if (!m_work || m_work->boxArray() != cba || m_work->DistributionMap() != mf.DistributionMap()) {
+        m_work = std::make_unique<amrex::MultiFab>(cba, mf.DistributionMap(), 1, 1);
+    }
+    amrex::MultiFab& work = *m_work;
+    amrex::Periodicity const period(domain.length());
+
+    AMREX_D_TERM(
+        amrex::Real const* fx = m_filter[0].data();,
+        amrex::Real const* fy = m_filter[1].data();,
+        amrex::Real const* fz = m_filter[2].data();
+    )
+    amrex::Real const scale = m_r2c->scalingFactor();
+
+    for (int n = 0; n < mf.nComp(); ++n) {
+
+        // Copy to the cell-centered work array: on a periodic domain, the last
+        // node of each box along a nodal direction duplicates the first node
+        // of the next box, so the node (i,j,k) is stored in the cell (i,j,k)
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(work, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            amrex::Array4<amrex::Real> const& w = work.array(mfi);
+            amrex::Array4<amrex::Real const> const& f = mf.const_array(mfi);
+            amrex::ParallelFor(mfi.tilebox(), [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                w(i,j,k) = f(i,j,k,n);
+            });
+        }
+
+        m_r2c->forwardThenBackward(work, work,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k, amrex::GpuComplex<amrex::Real>& sp) noexcept
+            {
+                amrex::ignore_unused(j,k);
+                sp *= scale * AMREX_D_TERM(fx[i], *fy[j], *fz[k]);
+            });
+
+        // Recover the duplicated nodes from the guard cells of the work array
+        work.FillBoundary(period);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(mf, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            amrex::Array4<amrex::Real const> const& w = work.const_array(mfi);
+            amrex::Array4<amrex::Real> const& f = mf.array(mfi);
+            amrex::ParallelFor(mfi.tilebox(), [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                f(i,j,k,n) = w(i,j,k);
+            });
+        }
+    }
+}
@@ -488,28 +488,20 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
 
     const amrex::BoxArray ba = fields.get(name_mf_N, lev)->boxArray();
 
-    // Temporary Half-step values
-#if defined(WARPX_DIM_3D)
-    amrex::MultiFab tmp_U_minus_x( amrex::convert(ba, IntVect(0,1,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_x( amrex::convert(ba, IntVect(0,1,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_minus_y( amrex::convert(ba, IntVect(1,0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_y( amrex::convert(ba, IntVect(1,0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_minus_z( amrex::convert(ba, IntVect(1,1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_z( amrex::convert(ba, IntVect(1,1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-    amrex::MultiFab tmp_U_minus_x( amrex::convert(ba, IntVect(0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_x( amrex::convert(ba, IntVect(0,1)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_minus_z( amrex::convert(ba, IntVect(1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_z( amrex::convert(ba, IntVect(1,0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-#elif defined(WARPX_DIM_1D_Z)
-    amrex::MultiFab tmp_U_minus_z( amrex::convert(ba, IntVect(0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_z( amrex::convert(ba, IntVect(0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-#elif defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
-    amrex::MultiFab tmp_U_minus_x( amrex::convert(ba, IntVect(0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-    amrex::MultiFab tmp_U_plus_x( amrex::convert(ba, IntVect(0)), fields.get(name_mf_N, lev)->DistributionMap(), 4, 1);
-#endif
+    // The edge values of N and U at the half timestep are computed per tile, in
+    // tile-local storage, and immediately used to compute the fluxes. With tiling,
+    // the edge computation of a tile reads N and NU in the neighboring tiles, so
+    // the update of N and NU is stored and applied after the loop over tiles.
+    // Without tiling (on GPU), each box only reads its own ghost cells and the
+    // update is done in place.
+    const bool store_update = amrex::TilingIfNotGPU();
+    amrex::MultiFab tmp_dQ;
+    if (store_update) {
+        tmp_dQ.define(ba, fields.get(name_mf_N, lev)->DistributionMap(), 4, 0);
+    }
 
-    // Fill edge values of N and U at the half timestep for MUSCL
+    // Fill edge values of N and U at the half timestep for MUSCL,
+    // compute fluxes in between nodes, and update N, NU accordingly
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -518,9 +510,12 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
 
         // Loop over a box with one extra gridpoint in the ghost region to avoid
         // an extra MPI communication between the edge value computation loop and
-        // the flux calculation loop
+        // the flux calculation loop. The tile is grown on all its faces, including
+        // those inside the box (unlike growntilebox), since the fluxes of the tile
+        // read the edge values of the neighboring points.
         const amrex::Box tile_box = [&](){
-            auto tt = mfi.growntilebox(1);
+            auto tt = mfi.tilebox();
+            tt.grow(1);
 #if defined (WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
             // Limit the grown box for RZ at r = 0, r_max
             const int idir = 0;
@@ -537,45 +532,59 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
         amrex::Array4<Real> const &NUz_arr = fields.get(name_mf_NU, Direction{2}, lev)->array(mfi);
 
         // Boxes are computed to avoid going out of bounds.
-        // Grow the entire domain
-        amrex::Box box = mfi.validbox();
+        // Grow the tile by one point, to include the edges read by the fluxes
+        amrex::Box box = mfi.tilebox();
         box.grow(1);
 #if defined(WARPX_DIM_3D)
-        amrex::Box const box_x = amrex::convert( box, tmp_U_minus_x.ixType() );
-        amrex::Box const box_y = amrex::convert( box, tmp_U_minus_y.ixType() );
-        amrex::Box const box_z = amrex::convert( box, tmp_U_minus_z.ixType() );
+        amrex::Box const box_x = amrex::convert( box, IntVect(0,1,1) );
+        amrex::Box const box_y = amrex::convert( box, IntVect(1,0,1) );
+        amrex::Box const box_z = amrex::convert( box, IntVect(1,1,0) );
 #elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-        amrex::Box const box_x = amrex::convert( box, tmp_U_minus_x.ixType() );
-        amrex::Box const box_z = amrex::convert( box, tmp_U_minus_z.ixType() );
+        amrex::Box const box_x = amrex::convert( box, IntVect(0,1) );
+        amrex::Box const box_z = amrex::convert( box, IntVect(1,0) );
 #elif defined(WARPX_DIM_1D_Z)
-        amrex::Box const box_z = amrex::convert( box, tmp_U_minus_z.ixType() );
+        amrex::Box const box_z = amrex::convert( box, IntVect(0) );
 #elif defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
-        amrex::Box const box_x = amrex::convert( box, tmp_U_minus_x.ixType() );
+        amrex::Box const box_x = amrex::convert( box, IntVect(0) );
 #endif
 
-        //N and NU are always defined at the nodes, the tmp_Q_* are defined
+        //N and NU are always defined at the nodes, the U_minus/U_plus are defined
         //in between the nodes (i.e. on the staggered Yee grid) and store the
         //values of N and U at these points.
         //(i.e. the 4 components correspond to N + the 3 components of U)
-        // Extract the temporary arrays for edge values
+        // Tile-local arrays for edge values
 #if defined(WARPX_DIM_3D)
-        const amrex::Array4<amrex::Real> U_minus_x = tmp_U_minus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_x = tmp_U_plus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_minus_y = tmp_U_minus_y.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_y = tmp_U_plus_y.array(mfi);
-        const amrex::Array4<amrex::Real> U_minus_z = tmp_U_minus_z.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_z = tmp_U_plus_z.array(mfi);
+        amrex::FArrayBox U_minus_x_fab(box_x, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_x_fab(box_x, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_minus_y_fab(box_y, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_y_fab(box_y, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_minus_z_fab(box_z, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_z_fab(box_z, 4, amrex::The_Async_Arena());
+        const amrex::Array4<amrex::Real> U_minus_x = U_minus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_x = U_plus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_minus_y = U_minus_y_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_y = U_plus_y_fab.array();
+        const amrex::Array4<amrex::Real> U_minus_z = U_minus_z_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_z = U_plus_z_fab.array();
 #elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-        const amrex::Array4<amrex::Real> U_minus_x = tmp_U_minus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_x = tmp_U_plus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_minus_z = tmp_U_minus_z.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_z = tmp_U_plus_z.array(mfi);
+        amrex::FArrayBox U_minus_x_fab(box_x, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_x_fab(box_x, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_minus_z_fab(box_z, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_z_fab(box_z, 4, amrex::The_Async_Arena());
+        const amrex::Array4<amrex::Real> U_minus_x = U_minus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_x = U_plus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_minus_z = U_minus_z_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_z = U_plus_z_fab.array();
 #elif defined(WARPX_DIM_1D_Z)
-        const amrex::Array4<amrex::Real> U_minus_z = tmp_U_minus_z.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_z = tmp_U_plus_z.array(mfi);
+        amrex::FArrayBox U_minus_z_fab(box_z, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_z_fab(box_z, 4, amrex::The_Async_Arena());
+        const amrex::Array4<amrex::Real> U_minus_z = U_minus_z_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_z = U_plus_z_fab.array();
 #elif defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
-        const amrex::Array4<amrex::Real> U_minus_x = tmp_U_minus_x.array(mfi);
-        const amrex::Array4<amrex::Real> U_plus_x = tmp_U_plus_x.array(mfi);
+        amrex::FArrayBox U_minus_x_fab(box_x, 4, amrex::The_Async_Arena());
+        amrex::FArrayBox U_plus_x_fab(box_x, 4, amrex::The_Async_Arena());
+        const amrex::Array4<amrex::Real> U_minus_x = U_minus_x_fab.array();
+        const amrex::Array4<amrex::Real> U_plus_x = U_plus_x_fab.array();
 #endif
 
         amrex::ParallelFor(tile_box,
@@ -820,72 +829,46 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
                 }
             }
         );
-    }
 
-    // Given the values of `U_minus` and `U_plus`, compute fluxes in between nodes, and update N, NU accordingly
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
-#endif
-    for (MFIter mfi(*fields.get(name_mf_N, lev), TilingIfNotGPU()); mfi.isValid(); ++mfi)
-    {
-        const amrex::Box tile_box = mfi.tilebox(fields.get(name_mf_N, lev)->ixType().toIntVect());
-        const amrex::Array4<Real> N_arr = fields.get(name_mf_N, lev)->array(mfi);
-        const amrex::Array4<Real> NUx_arr = fields.get(name_mf_NU, Direction{0}, lev)->array(mfi);
-        const amrex::Array4<Real> NUy_arr = fields.get(name_mf_NU, Direction{1}, lev)->array(mfi);
-        const amrex::Array4<Real> NUz_arr = fields.get(name_mf_NU, Direction{2}, lev)->array(mfi);
+        // Given the values of `U_minus` and `U_plus`, compute fluxes in between nodes, and update N, NU accordingly
+        const amrex::Box flux_box = mfi.tilebox();
+        const amrex::Array4<Real> dQ_arr = store_update ? tmp_dQ.array(mfi) : amrex::Array4<Real>{};
 
-#if defined(WARPX_DIM_3D)
-        amrex::Array4<amrex::Real> const &U_minus_x = tmp_U_minus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_x = tmp_U_plus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_minus_y = tmp_U_minus_y.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_y = tmp_U_plus_y.array(mfi);
-        amrex::Array4<amrex::Real> const &U_minus_z = tmp_U_minus_z.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_z = tmp_U_plus_z.array(mfi);
-#elif defined(WARPX_DIM_XZ) || defined(WARPX_DIM_RZ)
-        amrex::Array4<amrex::Real> const &U_minus_x = tmp_U_minus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_x = tmp_U_plus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_minus_z = tmp_U_minus_z.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_z = tmp_U_plus_z.array(mfi);
-#elif defined(WARPX_DIM_1D_Z)
-        amrex::Array4<amrex::Real> const &U_minus_z = tmp_U_minus_z.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_z = tmp_U_plus_z.array(mfi);
-#elif defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
-        amrex::Array4<amrex::Real> const &U_minus_x = tmp_U_minus_x.array(mfi);
-        amrex::Array4<amrex::Real> const &U_plus_x = tmp_U_plus_x.array(mfi);
-#endif
-
-        amrex::ParallelFor(tile_box,
+        amrex::ParallelFor(flux_box,
             [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
             {
 
+                // Increments of the conserved variables Q = [N, NU] from tn -> tn + dt
+                amrex::Real dQ0 = 0.0_rt, dQ1 = 0.0_rt, dQ2 = 0.0_rt, dQ3 = 0.0_rt;
+
                 // Select the specific implementation depending on dimensionality
 #if defined(WARPX_DIM_3D)
 
                 // Update the conserved variables Q = [N, NU] from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k)  - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
-                                             - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,0,1)
-                                             - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
-                                                - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,1,1)
-                                                - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
-                                                - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,2,1)
-                                                - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
-                                                - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,3,1)
-                                                - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
+                dQ0 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
+                      - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,0,1)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
+                dQ1 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
+                      - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,1,1)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
+                dQ2 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
+                      - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,2,1)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
+                dQ3 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
+                      - dt_over_dy*dF(U_minus_y,U_plus_y,i,j,k,clight,3,1)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
 
 #elif defined(WARPX_DIM_XZ)
 
                 // Update the conserved variables Q = [N, NU] from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k)  - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
-                                             - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
-                                                - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
-                                                - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
-                                                - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
+                dQ0 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,0,0)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
+                dQ1 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,1,0)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
+                dQ2 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,2,0)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
+                dQ3 = - dt_over_dx*dF(U_minus_x,U_plus_x,i,j,k,clight,3,0)
+                      - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
 
 #elif defined(WARPX_DIM_RZ)
 
@@ -945,10 +928,10 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
                 }
 
                 // Update the conserved variables from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k)     - (dt/Vij)*(F0_plusx - F0_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,0,2)*S_Az);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - (dt/Vij)*(F1_plusx - F1_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,1,2)*S_Az);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - (dt/Vij)*(F2_plusx - F2_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,2,2)*S_Az);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - (dt/Vij)*(F3_plusx - F3_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,3,2)*S_Az);
+                dQ0 = - (dt/Vij)*(F0_plusx - F0_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,0,2)*S_Az);
+                dQ1 = - (dt/Vij)*(F1_plusx - F1_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,1,2)*S_Az);
+                dQ2 = - (dt/Vij)*(F2_plusx - F2_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,2,2)*S_Az);
+                dQ3 = - (dt/Vij)*(F3_plusx - F3_minusx + dF(U_minus_z,U_plus_z,i,j,k,clight,3,2)*S_Az);
 
 #elif defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
 
@@ -1024,22 +1007,60 @@ void WarpXFluidContainer::AdvectivePush_Muscl (ablastr::fields::MultiFabRegister
                 }
 
                 // Update the conserved variables from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k)     - (dt/Vij)*(F0_plusx - F0_minusx);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - (dt/Vij)*(F1_plusx - F1_minusx);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - (dt/Vij)*(F2_plusx - F2_minusx);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - (dt/Vij)*(F3_plusx - F3_minusx);
+                dQ0 = - (dt/Vij)*(F0_plusx - F0_minusx);
+                dQ1 = - (dt/Vij)*(F1_plusx - F1_minusx);
+                dQ2 = - (dt/Vij)*(F2_plusx - F2_minusx);
+                dQ3 = - (dt/Vij)*(F3_plusx - F3_minusx);
 
 #elif defined(WARPX_DIM_1D_Z)
 
                 // Update the conserved variables Q = [N, NU] from tn -> tn + dt
-                N_arr(i,j,k) = N_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
-                NUx_arr(i,j,k) = NUx_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
-                NUy_arr(i,j,k) = NUy_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
-                NUz_arr(i,j,k) = NUz_arr(i,j,k) - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
+                dQ0 = - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,0,2);
+                dQ1 = - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,1,2);
+                dQ2 = - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,2,2);
+                dQ3 = - dt_over_dz*dF(U_minus_z,U_plus_z,i,j,k,clight,3,2);
 #endif
+
+                if (store_update) {
+                    dQ_arr(i,j,k,0) = dQ0;
+                    dQ_arr(i,j,k,1) = dQ1;
+                    dQ_arr(i,j,k,2) = dQ2;
+                    dQ_arr(i,j,k,3) = dQ3;
+                } else {
+                    N_arr(i,j,k) += dQ0;
+                    NUx_arr(i,j,k) += dQ1;
+                    NUy_arr(i,j,k) += dQ2;
+                    NUz_arr(i,j,k) += dQ3;
+                }
             }
         );
     }
+
+    // Apply the stored update of N and NU
+    if (store_update) {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(*fields.get(name_mf_N, lev), TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const amrex::Box tile_box = mfi.tilebox();
+            const amrex::Array4<Real> N_arr = fields.get(name_mf_N, lev)->array(mfi);
+            const amrex::Array4<Real> NUx_arr = fields.get(name_mf_NU, Direction{0}, lev)->array(mfi);
+            const amrex::Array4<Real> NUy_arr = fields.get(name_mf_NU, Direction{1}, lev)->array(mfi);
+            const amrex::Array4<Real> NUz_arr = fields.get(name_mf_NU, Direction{2}, lev)->array(mfi);
+            const amrex::Array4<Real const> dQ_arr = tmp_dQ.const_array(mfi);
+
+            amrex::ParallelFor(tile_box,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+                {
+                    N_arr(i,j,k) += dQ_arr(i,j,k,0);
+                    NUx_arr(i,j,k) += dQ_arr(i,j,k,1);
+                    NUy_arr(i,j,k) += dQ_arr(i,j,k,2);
+                    NUz_arr(i,j,k) += dQ_arr(i,j,k,3);
+                }
+            );
+        }
+    }
 }
 
 
@@ -14,20 +14,191 @@
 #include <ablastr/warn_manager/WarnManager.H>
 
 #include <AMReX_BaseFabUtility.H>
+#include <AMReX_GpuDevice.H>
+#include <AMReX_Loop.H>
+#include <AMReX_ParmParse.H>
 
 #if defined(WARPX_USE_OPENPMD) && !defined(WARPX_DIM_RCYLINDER) && !defined(WARPX_DIM_RSPHERE)
 #   include <openPMD/openPMD.hpp>
 #endif
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <functional>
+#include <limits>
+#include <map>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 namespace
 {
     enum class EMFieldType{E, B};
 
+#if defined(WARPX_USE_OPENPMD) && !defined(WARPX_DIM_RCYLINDER) && !defined(WARPX_DIM_RSPHERE)
+    /** Read the grid of the mesh record `F`, whose component `FC` is loaded */
+    ExternalFieldGrid read_grid (openPMD::Mesh& F, openPMD::MeshRecordComponent& FC)
+    {
+        using namespace amrex;
+
+        ExternalFieldGrid grid;
+
+        grid.c_order = F.getAttribute("dataOrder").get<std::string>() == "C";
+
+        auto axisLabels = F.getAttribute("axisLabels").get<std::vector<std::string>>();
+        auto fileGeom = F.getAttribute("geometry").get<std::string>();
+
+        bool xyz_order = true; //NOLINT (misc-const-correctness)
+
+#if defined(WARPX_DIM_3D)
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "cartesian", "3D can only read from files with cartesian geometry");
+        if (axisLabels.at(0) == "x" && axisLabels.at(1) == "y" && axisLabels.at(2) == "z") {
+            xyz_order = true;
+        } else if (axisLabels.at(2) == "x" && axisLabels.at(1) == "y" && axisLabels.at(0) == "z") {
+            xyz_order = false;
+        } else {
+            WARPX_ABORT_WITH_MESSAGE("3D expects axisLabels {x, y, z} or {z, y, x}");
+        }
+#elif defined(WARPX_DIM_XZ)
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "cartesian", "XZ can only read from files with cartesian geometry");
+        if (axisLabels.at(0) == "x" && axisLabels.at(1) == "z") {
+            xyz_order = true;
+        } else if (axisLabels.at(1) == "x" && axisLabels.at(0) == "z") {
+            xyz_order = false;
+        } else {
+            WARPX_ABORT_WITH_MESSAGE("XZ expects axisLabels {x, z} or {z, x}");
+        }
+#elif defined(WARPX_DIM_RZ)
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "thetaMode", "RZ can only read from files with 'thetaMode'  geometry");
+        if (axisLabels.at(0) == "r" && axisLabels.at(1) == "z") {
+            xyz_order = true;
+        } else if (axisLabels.at(1) == "r" && axisLabels.at(0) == "z") {
+            xyz_order = false;
+        } else {
+            WARPX_ABORT_WITH_MESSAGE("RZ expects axisLabels {r, z} or {z, r}");
+        }
+#elif defined(WARPX_DIM_1D_Z)
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "cartesian", "1D3V can only read from files with cartesian geometry");
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(axisLabels.at(0) == "z", "1D3V expects axisLabel {z}");
+#endif
+        grid.xyz_order = xyz_order;
+
+        const auto d = F.gridSpacing<long double>();
+        if (xyz_order) {
+            AMREX_D_TERM(grid.dx[0] = Real(d.at(0));,
+                         grid.dx[1] = Real(d.at(1));,
+                         grid.dx[2] = Real(d.at(2)));
+        } else {
+            AMREX_D_TERM(grid.dx[0] = Real(d.at(AMREX_SPACEDIM-1));,
+                         grid.dx[1] = Real(d.at(AMREX_SPACEDIM-2));,
+                         grid.dx[2] = Real(d.at(AMREX_SPACEDIM-3)));
+        }
+
+        const auto offset = F.gridGlobalOffset();
+        if (xyz_order) {
+            AMREX_D_TERM(grid.offset[0] = Real(offset.at(0));,
+                         grid.offset[1] = Real(offset.at(1));,
+                         grid.offset[2] = Real(offset.at(2)));
+        } else {
+            AMREX_D_TERM(grid.offset[0] = Real(offset.at(AMREX_SPACEDIM-1));,
+                         grid.offset[1] = Real(offset.at(AMREX_SPACEDIM-2));,
+                         grid.offset[2] = Real(offset.at(AMREX_SPACEDIM-3)));
+        }
+
+        const auto extent = FC.getExtent();
+        for (auto ex : extent) {
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(ex < decltype(ex)(std::numeric_limits<int>::max()),
+                                             "The openPMD file is too big");
+        }
+        grid.ndims = static_cast<int>(extent.size());
+#if defined(WARPX_DIM_RZ)
+        // extent[0] is for theta
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(extent.size() == 3 && extent[0] == 1,
+                                         "External field reading is not implemented for more than one RZ mode (see #3829)");
+        if (xyz_order) {
+            grid.size[0] = static_cast<int>(extent[1]);
+            grid.size[1] = static_cast<int>(extent[2]);
+        } else {
+            grid.size[0] = static_cast<int>(extent[2]);
+            grid.size[1] = static_cast<int>(extent[1]);
+        }
+#else
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(extent.size() == AMREX_SPACEDIM,
+                                         "The openPMD file has wrong dimension.");
+        if (xyz_order) {
+            AMREX_D_TERM(grid.size[0] = int(extent.at(0));,
+                         grid.size[1] = int(extent.at(1));,
+                         grid.size[2] = int(extent.at(2)));
+        } else {
+            AMREX_D_TERM(grid.size[0] = int(extent.at(AMREX_SPACEDIM-1));,
+                         grid.size[1] = int(extent.at(AMREX_SPACEDIM-2));,
+                         grid.size[2] = int(extent.at(AMREX_SPACEDIM-3)));
+        }
+#endif
+
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            grid.domain.setLo(idim, grid.offset[idim]);
+            grid.domain.setHi(idim, grid.offset[idim]+(grid.size[idim]-1)*grid.dx[idim]);
+        }
+        return grid;
+    }
+
+    /** Offset and extent in the file of the data points [lo, hi] (in the axis order of WarpX) */
+    std::pair<openPMD::Offset, openPMD::Extent>
+    chunk_bounds (ExternalFieldGrid const& grid, amrex::IntVect const& lo, amrex::IntVect const& hi)
+    {
+        openPMD::Offset chunk_offset(grid.ndims,0);
+        openPMD::Extent chunk_extent(grid.ndims,1);
+#if defined(WARPX_DIM_RZ)
+        if (grid.xyz_order) {
+            chunk_offset[1] = lo[0];
+            chunk_offset[2] = lo[1];
+            chunk_extent[1] = hi[0]-lo[0]+1;
+            chunk_extent[2] = hi[1]-lo[1]+1;
+        } else {
+            chunk_offset[2] = lo[0];
+            chunk_offset[1] = lo[1];
+            chunk_extent[2] = hi[0]-lo[0]+1;
+            chunk_extent[1] = hi[1]-lo[1]+1;
+        }
+#else
+        if (grid.xyz_order) {
+            AMREX_D_TERM(chunk_offset[0] = lo[0];,
+                         chunk_offset[1] = lo[1];,
+                         chunk_offset[2] = lo[2]);
+            AMREX_D_TERM(chunk_extent[0] = hi[0]-lo[0]+1;,
+                         chunk_extent[1] = hi[1]-lo[1]+1;,
+                         chunk_extent[2] = hi[2]-lo[2]+1);
+        } else {
+            AMREX_D_TERM(chunk_offset[AMREX_SPACEDIM-1] = lo[0];,
+                         chunk_offset[AMREX_SPACEDIM-2] = lo[1];,
+                         chunk_offset[AMREX_SPACEDIM-3] = lo[2]);
+            AMREX_D_TERM(chunk_extent[AMREX_SPACEDIM-1] = hi[0]-lo[0]+1;,
+                         chunk_extent[AMREX_SPACEDIM-2] = hi[1]-lo[1]+1;,
+                         chunk_extent[AMREX_SPACEDIM-3] = hi[2]-lo[2]+1);
+        }
+#endif
+        return {chunk_offset, chunk_extent};
+    }
+
+    /** Allocate a buffer in pinned memory for `num_cells` values */
+    std::shared_ptr<double> alloc_pinned_buffer (std::size_t num_cells)
+    {
+        return std::shared_ptr<double>(
+            reinterpret_cast<double*>(amrex::The_Pinned_Arena()->alloc(num_cells*sizeof(double))),
+            [](double *p){ amrex::The_Pinned_Arena()->free(reinterpret_cast<void*>(p)); });
+    }
+#endif
+
+#if (AMREX_SPACEDIM > 1)
+    /** Whether the data read from the file must be transposed to be in Fortran order */
+    bool needs_transpose (ExternalFieldGrid const& grid)
+    {
+        return (grid.xyz_order && grid.c_order) || (!grid.xyz_order && !grid.c_order);
+    }
+#endif
+
     template <EMFieldType T>
     ExternalFieldType string_to_external_field_type(std::string s)
     {
@@ -214,121 +385,22 @@ void ExternalFieldReader::load_data (amrex::RealBox const& pbox)
     auto iseries = series.iterations.begin()->second;
     auto F = iseries.meshes[m_name];
 
-    const bool c_order = F.getAttribute("dataOrder").get<std::string>() == "C";
-    amrex::ignore_unused(c_order);
-
-    auto axisLabels = F.getAttribute("axisLabels").get<std::vector<std::string>>();
-    auto fileGeom = F.getAttribute("geometry").get<std::string>();
-
-    bool xyz_order = true; //NOLINT (misc-const-correctness)
-
-#if defined(WARPX_DIM_3D)
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "cartesian", "3D can only read from files with cartesian geometry");
-    if (axisLabels.at(0) == "x" && axisLabels.at(1) == "y" && axisLabels.at(2) == "z") {
-        xyz_order = true;
-    } else if (axisLabels.at(2) == "x" && axisLabels.at(1) == "y" && axisLabels.at(0) == "z") {
-        xyz_order = false;
-    } else {
-        WARPX_ABORT_WITH_MESSAGE("3D expects axisLabels {x, y, z} or {z, y, x}");
-    }
-#elif defined(WARPX_DIM_XZ)
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "cartesian", "XZ can only read from files with cartesian geometry");
-    if (axisLabels.at(0) == "x" && axisLabels.at(1) == "z") {
-        xyz_order = true;
-    } else if (axisLabels.at(1) == "x" && axisLabels.at(0) == "z") {
-        xyz_order = false;
-    } else {
-        WARPX_ABORT_WITH_MESSAGE("XZ expects axisLabels {x, z} or {z, x}");
-    }
-#elif defined(WARPX_DIM_RZ)
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "thetaMode", "RZ can only read from files with 'thetaMode'  geometry");
-    if (axisLabels.at(0) == "r" && axisLabels.at(1) == "z") {
-        xyz_order = true;
-    } else if (axisLabels.at(1) == "r" && axisLabels.at(0) == "z") {
-        xyz_order = false;
-    } else {
-        WARPX_ABORT_WITH_MESSAGE("RZ expects axisLabels {r, z} or {z, r}");
-    }
-#elif defined(WARPX_DIM_1D_Z)
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(fileGeom == "cartesian", "1D3V can only read from files with cartesian geometry");
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(axisLabels.at(0) == "z", "1D3V expects axisLabel {z}");
-#endif
-
-    const auto d = F.gridSpacing<long double>();
-    if (xyz_order) {
-        AMREX_D_TERM(m_dx[0] = Real(d.at(0));,
-                     m_dx[1] = Real(d.at(1));,
-                     m_dx[2] = Real(d.at(2)));
-    } else {
-        AMREX_D_TERM(m_dx[0] = Real(d.at(AMREX_SPACEDIM-1));,
-                     m_dx[1] = Real(d.at(AMREX_SPACEDIM-2));,
-                     m_dx[2] = Real(d.at(AMREX_SPACEDIM-3)));
-    }
-
-    const auto offset = F.gridGlobalOffset();
-    if (xyz_order) {
-        AMREX_D_TERM(m_offset[0] = Real(offset.at(0));,
-                     m_offset[1] = Real(offset.at(1));,
-                     m_offset[2] = Real(offset.at(2)));
-    } else {
-        AMREX_D_TERM(m_offset[0] = Real(offset.at(AMREX_SPACEDIM-1));,
-                     m_offset[1] = Real(offset.at(AMREX_SPACEDIM-2));,
-                     m_offset[2] = Real(offset.at(AMREX_SPACEDIM-3)));
-    }
-
     // Load the first component if m_component is empty
     auto FC = m_component.empty() ? F.begin()->second : F[m_component];
-    const auto extent = FC.getExtent();
-    for (auto ex : extent) {
-        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(ex < decltype(ex)(std::numeric_limits<int>::max()),
-                                         "The openPMD file is too big");
-    }
-#if defined(WARPX_DIM_RZ)
-    // extent[0] is for theta
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(extent.size() == 3 && extent[0] == 1,
-                                     "External field reading is not implemented for more than one RZ mode (see #3829)");
-    if (xyz_order) {
-        m_size[0] = static_cast<int>(extent[1]);
-        m_size[1] = static_cast<int>(extent[2]);
-    } else {
-        m_size[0] = static_cast<int>(extent[2]);
-        m_size[1] = static_cast<int>(extent[1]);
-    }
-#else
-    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(extent.size() == AMREX_SPACEDIM,
-                                     "The openPMD file has wrong dimension.");
-    if (xyz_order) {
-        AMREX_D_TERM(m_size[0] = int(extent.at(0));,
-                     m_size[1] = int(extent.at(1));,
-                     m_size[2] = int(extent.at(2)));
-    } else {
-        AMREX_D_TERM(m_size[0] = int(extent.at(AMREX_SPACEDIM-1));,
-                     m_size[1] = int(extent.at(AMREX_SPACEDIM-2));,
-                     m_size[2] = int(extent.at(AMREX_SPACEDIM-3)));
-    }
-#endif
 
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        m_domain.setLo(idim, m_offset[idim]);
-        m_domain.setHi(idim, m_offset[idim]+(m_size[idim]-1)*m_dx[idim]);
-    }
+    auto const grid = read_grid(F, FC);
+    m_dx = grid.dx;
+    m_offset = grid.offset;
+    m_size = grid.size;
+    m_domain = grid.domain;
 
     // Determine the full extent of the data we need
     IntVect lo, hi;
     if (m_distributed) {
-        bool is_empty = false;
-        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-            auto plo = pbox.lo(idim);
-            auto phi = pbox.hi(idim);
-            auto ilo = int(std::floor( (plo-m_offset[idim])/m_dx[idim] ));
-            auto ihi = int(std::floor( (phi-m_offset[idim])/m_dx[idim] ))+1; // +1 for interpolation
-            --ilo; // in case there are roundoff errors
-            ++ihi;
-            lo[idim] = std::max(ilo, 0);
-            hi[idim] = std::min(ihi, m_size[idim]-1);
-            if (hi[idim] < lo[idim]) { is_empty = true; }
-        }
-        if (is_empty) { return; } // The openPMD file does not have the data we need.
+        auto const b = data_box(pbox);
+        if (b.isEmpty()) { return; } // The openPMD file does not have the data we need.
+        lo = b.smallEnd();
+        hi = b.bigEnd();
     } else {
         lo = IntVect(0);
         hi = m_size-1;
@@ -339,11 +411,9 @@ void ExternalFieldReader::load_data (amrex::RealBox const& pbox)
     DistributionMapping dmap;
     bool has_load = true;
     if (m_distributed && !m_moving_window) {
-        // At this point, the data is distributed in an arbitrary way.  For
-        // moving window, the data is loaded in a different way. We
-        // duplicate the data needed for initializing the newly added
-        // region, because the amount of data is relatively small and
-        // because the duplicated approach is much simpler.
+        // At this point, the data is distributed in an arbitrary way. For
+        // moving window, the data is loaded through an ExternalFieldTileCache
+        // instead.
         grids = amrex::decompose(Box(lo,hi), ParallelDescriptor::NProcs());
         Vector<int> pmap(grids.size());
         std::iota(pmap.begin(), pmap.end(), 0);
@@ -357,44 +427,12 @@ void ExternalFieldReader::load_data (amrex::RealBox const& pbox)
         }
     }
 
-    openPMD::Offset chunk_offset(extent.size(),0);
-    openPMD::Extent chunk_extent(extent.size(),1);
-#if defined(WARPX_DIM_RZ)
-    if (xyz_order) {
-        chunk_offset[1] = lo[0];
-        chunk_offset[2] = lo[1];
-        chunk_extent[1] = hi[0]-lo[0]+1;
-        chunk_extent[2] = hi[1]-lo[1]+1;
-    } else {
-        chunk_offset[2] = lo[0];
-        chunk_offset[1] = lo[1];
-        chunk_extent[2] = hi[0]-lo[0]+1;
-        chunk_extent[1] = hi[1]-lo[1]+1;
-    }
-#else
-    if (xyz_order) {
-        AMREX_D_TERM(chunk_offset[0] = lo[0];,
-                     chunk_offset[1] = lo[1];,
-                     chunk_offset[2] = lo[2]);
-        AMREX_D_TERM(chunk_extent[0] = hi[0]-lo[0]+1;,
-                     chunk_extent[1] = hi[1]-lo[1]+1;,
-                     chunk_extent[2] = hi[2]-lo[2]+1);
-    } else {
-        AMREX_D_TERM(chunk_offset[AMREX_SPACEDIM-1] = lo[0];,
-                     chunk_offset[AMREX_SPACEDIM-2] = lo[1];,
-                     chunk_offset[AMREX_SPACEDIM-3] = lo[2]);
-        AMREX_D_TERM(chunk_extent[AMREX_SPACEDIM-1] = hi[0]-lo[0]+1;,
-                     chunk_extent[AMREX_SPACEDIM-2] = hi[1]-lo[1]+1;,
-                     chunk_extent[AMREX_SPACEDIM-3] = hi[2]-lo[2]+1);
-    }
-#endif
+    auto const [chunk_offset, chunk_extent] = chunk_bounds(grid, lo, hi);
 
     if (has_load) {
         const auto num_cells = std::accumulate(chunk_extent.begin(), chunk_extent.end(),
                                                1, std::multiplies<>());
-        m_FC_data_cpu.reset(
-            reinterpret_cast<double*>(amrex::The_Pinned_Arena()->alloc(num_cells*sizeof(double))),
-            [](double *p){ amrex::The_Pinned_Arena()->free(reinterpret_cast<void*>(p)); });
+        m_FC_data_cpu = alloc_pinned_buffer(num_cells);
         FC.loadChunk<double>(m_FC_data_cpu, chunk_offset, chunk_extent);
     }
     series.flush();
@@ -411,7 +449,7 @@ void ExternalFieldReader::load_data (amrex::RealBox const& pbox)
 #endif
 
 #if (AMREX_SPACEDIM > 1)
-        if ((xyz_order && c_order) || (!xyz_order && !c_order)) {
+        if (needs_transpose(grid)) {
             BaseFab<double> tmp(box, 1);
             amrex::transposeCtoF(m_fab.dataPtr(), tmp.dataPtr(),
                                  AMREX_D_DECL(box.length(0),
@@ -438,6 +476,22 @@ void ExternalFieldReader::load_data (amrex::RealBox const& pbox)
 #endif
 }
 
+amrex::Box ExternalFieldReader::data_box (amrex::RealBox const& pbox) const
+{
+    amrex::IntVect lo, hi;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        auto plo = pbox.lo(idim);
+        auto phi = pbox.hi(idim);
+        auto ilo = int(std::floor( (plo-m_offset[idim])/m_dx[idim] ));
+        auto ihi = int(std::floor( (phi-m_offset[idim])/m_dx[idim] ))+1; // +1 for interpolation
+        --ilo; // in case there are roundoff errors
+        ++ihi;
+        lo[idim] = std::max(ilo, 0);
+        hi[idim] = std::min(ihi, m_size[idim]-1);
+    }
+    return amrex::Box(lo, hi); // empty if hi < lo in any direction
+}
+
 void ExternalFieldReader::prepare (amrex::BoxArray const& grids,
                                    amrex::DistributionMapping const& dmap,
                                    amrex::IntVect const& ngrow,
@@ -496,30 +550,26 @@ void ExternalFieldReader::prepare (amrex::BoxArray const& grids,
     }
 }
 
-void ExternalFieldReader::make_cache_box (amrex::RealBox const& pbox, int moving_dir, int moving_sign)
-{
-    m_cache_domain = pbox;
-    const int dir = std::abs(moving_dir);
-    const amrex::Real factor = 10.0;
-    if (moving_sign > 0) {
-        const amrex::Real newhi = m_cache_domain.hi(dir) + factor*m_cache_domain.length(dir);
-        m_cache_domain.setHi(dir, newhi);
-    } else {
-        const amrex::Real newlo = m_cache_domain.lo(dir) - factor*m_cache_domain.length(dir);
-        m_cache_domain.setLo(dir, newlo);
-    }
-    // Grow the box a little bit so that m_cache_domain.contains(pbox) is true.
-    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-        m_cache_domain.setLo(idim, m_cache_domain.lo(idim) - m_dx[idim]);
-        m_cache_domain.setHi(idim, m_cache_domain.hi(idim) + m_dx[idim]);
-    }
-}
-
 void ExternalFieldReader::prepare (amrex::RealBox const& pbox, int moving_dir, int moving_sign,
                                    std::function<amrex::Real(amrex::Real)> const& get_zlab)
 {
     if (! m_distributed) { return; }
 
+    if (!m_moving_window) {
+        m_moving_window = true;
+        m_mf.clear();
+        m_fab.clear();
+        m_FC_data_cpu.reset();
+        m_tile_cache = ExternalFieldTileCache::get(m_file, m_name, m_component);
+        auto const& grid = m_tile_cache->grid();
+        m_dx = grid.dx;
+        m_offset = grid.offset;
+        m_size = grid.size;
+        m_domain = grid.domain;
+    }
+
+    if (! pbox.ok()) { return; } // This process does not need any data.
+
     auto pboxz = pbox;
     if (get_zlab) {
         auto zlo = get_zlab(pbox.lo(AMREX_SPACEDIM-1));
@@ -528,18 +578,192 @@ void ExternalFieldReader::prepare (amrex::RealBox const& pbox, int moving_dir, i
         pboxz.setHi(AMREX_SPACEDIM-1, zhi);
     }
 
-    if (!m_moving_window) {
-        m_moving_window = true;
-        m_mf.clear();
-        make_cache_box(pboxz, moving_dir, moving_sign);
-        load_data(m_cache_domain);
-    } else {
-        if (! m_cache_domain.contains(pboxz)) {
-            make_cache_box(pboxz, moving_dir, moving_sign);
-            if (m_cache_domain.intersects(m_domain)) {
-                load_data(m_cache_domain);
+    const amrex::Box needed = data_box(pboxz);
+    if (needed.isEmpty()) { return; } // The openPMD file does not have the data we need.
+
+    const int dir = std::abs(moving_dir);
+    const int tile_length = m_tile_cache->tileSize()[dir];
+    if (m_fab.dataPtr() == nullptr || !m_fab.box().contains(needed)) {
+        // Extend the data along the moving direction up to the end of the
+        // last tile, so that the data are copied from the cache once per tile
+        amrex::Box b = needed;
+        if (moving_sign > 0) {
+            b.setBig(dir, std::min((b.bigEnd(dir)/tile_length+1)*tile_length-1, m_size[dir]-1));
+        } else {
+            b.setSmall(dir, (b.smallEnd(dir)/tile_length)*tile_length);
+        }
+        m_fab = amrex::BaseFab<double>(b, 1);
+        m_tile_cache->fill(m_fab, b);
+    }
+
+    // Load the tiles that will be needed next, ahead of need
+    amrex::Box next = m_fab.box();
+    next.shift(dir, moving_sign*tile_length);
+    m_tile_cache->prefetch(next);
+}
+
+std::shared_ptr<ExternalFieldTileCache>
+ExternalFieldTileCache::get (std::string const& file, std::string const& name, std::string const& component)
+{
+    // The caches are owned by the readers: they are released with the last reader.
+    static std::map<std::string, std::weak_ptr<ExternalFieldTileCache>> caches;
+    auto& weak_cache = caches[file + '\n' + name + '\n' + component];
+    auto cache = weak_cache.lock();
+    if (!cache) {
+        cache = std::make_shared<ExternalFieldTileCache>(file, name, component);
+        weak_cache = cache;
+    }
+    return cache;
+}
+
+ExternalFieldTileCache::ExternalFieldTileCache (std::string file, std::string name, std::string component)
+    : m_file(std::move(file)),
+      m_name(std::move(name)),
+      m_component(std::move(component)),
+      m_tile_size(64)
+{
+    const amrex::ParmParse pp_warpx("warpx");
+    std::vector<int> tile_size;
+    if (utils::parser::queryArrWithParser(pp_warpx, "external_field_cache_tile_size", tile_size, 0, AMREX_SPACEDIM)) {
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) { m_tile_size[idim] = tile_size[idim]; }
+    }
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_tile_size.allGT(1),
+        "warpx.external_field_cache_tile_size must be larger than 1");
+    utils::parser::queryWithParser(pp_warpx, "external_field_cache_max_memory", m_max_memory);
+    pp_warpx.query("external_field_cache_prefetch", m_do_prefetch);
+
+#if defined(WARPX_USE_OPENPMD) && !defined(WARPX_DIM_RCYLINDER) && !defined(WARPX_DIM_RSPHERE)
+    auto series = openPMD::Series(m_file, openPMD::Access::READ_ONLY);
+    auto iseries = series.iterations.begin()->second;
+    auto F = iseries.meshes[m_name];
+    // Load the first component if m_component is empty
+    auto FC = m_component.empty() ? F.begin()->second : F[m_component];
+    m_grid = read_grid(F, FC);
+#else
+    WARPX_ABORT_WITH_MESSAGE("ExternalFieldReader requires openPMD and it is not supported for 1D RCYLINDER and RSPHERE");
+#endif
+}
+
+amrex::Box ExternalFieldTileCache::tileBox (TileKey const& key) const
+{
+    amrex::IntVect lo, hi;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        lo[idim] = key[idim]*m_tile_size[idim];
+        hi[idim] = std::min(lo[idim]+m_tile_size[idim]-1, m_grid.size[idim]-1);
+    }
+    return amrex::Box(lo, hi);
+}
+
+amrex::Vector<ExternalFieldTileCache::TileKey>
+ExternalFieldTileCache::missingTiles (amrex::Box const& box) const
+{
+    amrex::Vector<TileKey> keys;
+    const amrex::Box b = box & amrex::Box(amrex::IntVect(0), m_grid.size-1);
+    if (b.isEmpty()) { return keys; }
+    const amrex::IntVect tlo = b.smallEnd() / m_tile_size;
+    const amrex::IntVect thi = b.bigEnd() / m_tile_size;
+    amrex::LoopOnCpu(amrex::Box(tlo, thi), [&] (int i, int j, int k)
+    {
+        amrex::ignore_unused(j, k);
+        const TileKey key{AMREX_D_DECL(i, j, k)};
+        if (m_tiles.count(key) == 0) { keys.push_back(key); }
+    });
+    return keys;
+}
+
+amrex::Vector<std::shared_ptr<double>>
+ExternalFieldTileCache::loadTilesHost (amrex::Vector<TileKey> const& keys) const
+{
+    amrex::Vector<std::shared_ptr<double>> buffers;
+#if defined(WARPX_USE_OPENPMD) && !defined(WARPX_DIM_RCYLINDER) && !defined(WARPX_DIM_RSPHERE)
+    auto series = openPMD::Series(m_file, openPMD::Access::READ_ONLY);
+    auto iseries = series.iterations.begin()->second;
+    auto F = iseries.meshes[m_name];
+    auto FC = m_component.empty() ? F.begin()->second : F[m_component];
+    for (auto const& key : keys) {
+        const amrex::Box box = tileBox(key);
+        auto const [chunk_offset, chunk_extent] = chunk_bounds(m_grid, box.smallEnd(), box.bigEnd());
+        buffers.push_back(alloc_pinned_buffer(box.numPts()));
+        FC.loadChunk<double>(buffers.back(), chunk_offset, chunk_extent);
+    }
+    series.flush();
+#else
+    amrex::ignore_unused(keys);
+#endif
+    return buffers;
+}
+
+void ExternalFieldTileCache::insertTiles (amrex::Vector<TileKey> const& keys,
+                                          amrex::Vector<std::shared_ptr<double>> const& buffers)
+{
+    for (int i = 0; i < keys.size(); ++i) {
+        const amrex::Box box = tileBox(keys[i]);
+        Tile tile;
+        tile.fab.resize(box, 1);
+#ifdef AMREX_USE_GPU
+        amrex::Gpu::htod_memcpy_async(tile.fab.dataPtr(), buffers[i].get(), tile.fab.nBytes());
+#else
+        std::memcpy(tile.fab.dataPtr(), buffers[i].get(), tile.fab.nBytes());
+#endif
+#if (AMREX_SPACEDIM > 1)
+        if (needs_transpose(m_grid)) {
+            amrex::BaseFab<double> tmp(box, 1);
+            amrex::transposeCtoF(tile.fab.dataPtr(), tmp.dataPtr(),
+                                 AMREX_D_DECL(box.length(0),
+                                              box.length(1),
+                                              box.length(2)));
+            amrex::Gpu::streamSynchronize();
+            std::swap(tile.fab, tmp);
+        }
+#endif
+        amrex::Gpu::streamSynchronize();
+        m_tiles[keys[i]] = std::move(tile);
+    }
+}
+
+void ExternalFieldTileCache::fill (amrex::BaseFab<double>& fab, amrex::Box const& box)
+{
+    const auto keys = missingTiles(box);
+    if (!keys.empty()) { insertTiles(keys, loadTilesHost(keys)); }
+
+    ++m_use_stamp;
+    for (auto& [key, tile] : m_tiles) {
+        const amrex::Box b = tile.fab.box() & box;
+        if (b.isEmpty()) { continue; }
+        fab.copy<amrex::RunOn::Device>(tile.fab, b, 0, b, 0, 1);
+        tile.last_use = m_use_stamp;
+    }
+    amrex::Gpu::streamSynchronize();
+    evict();
+}
+
+void ExternalFieldTileCache::prefetch (amrex::Box const& box)
+{
+    if (!m_do_prefetch) { return; }
+    // The tiles are read on this thread: openPMD is not thread-safe, and the
+    // diagnostics may use it at any time outside of this function
+    const auto keys = missingTiles(box);
+    if (!keys.empty()) { insertTiles(keys, loadTilesHost(keys)); }
+}
+
+void ExternalFieldTileCache::evict ()
+{
+    double memory = 0.;
+    for (auto const& [key, tile] : m_tiles) {
+        memory += static_cast<double>(tile.fab.nBytes());
+    }
+    while (memory > m_max_memory) {
+        // The tiles used by the last `fill` are kept in any case
+        auto lru = m_tiles.end();
+        for (auto it = m_tiles.begin(); it != m_tiles.end(); ++it) {
+            if (it->second.last_use < m_use_stamp &&
+                (lru == m_tiles.end() || it->second.last_use < lru->second.last_use)) {
+                lru = it;
             }
         }
+        if (lru == m_tiles.end()) { break; }
+        memory -= static_cast<double>(lru->second.fab.nBytes());
+        m_tiles.erase(lru);
     }
 }
 
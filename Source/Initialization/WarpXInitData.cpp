@@ -26,6 +26,9 @@
 #include "FieldSolver/FiniteDifferenceSolver/HybridPICModel/HybridPICModel.H"
 #include "FieldSolver/ImplicitSolvers/ImplicitSolver.H"
 #include "Filter/BilinearFilter.H"
+#ifdef WARPX_USE_FFT
+#   include "Filter/KSpaceBinomialFilter.H"
+#endif
 #include "Filter/NCIGodfreyFilter.H"
 #include "Initialization/ExternalField.H"
 #include "Initialization/DivCleaner/ProjectionDivCleaner.H"
@@ -1208,7 +1211,14 @@ void
 WarpX::InitFilter (){
     if (WarpX::use_filter){
         WarpX::bilinear_filter.npass_each_dir = WarpX::filter_npass_each_dir.toArray<unsigned int>();
+        WarpX::bilinear_filter.use_separable_stencil = WarpX::use_separable_filter;
         WarpX::bilinear_filter.ComputeStencils();
+#ifdef WARPX_USE_FFT
+        if (WarpX::filter_current_in_kspace && !kspace_binomial_filter) {
+            kspace_binomial_filter = std::make_unique<KSpaceBinomialFilter>(
+                WarpX::filter_npass_each_dir, WarpX::use_filter_compensation);
+        }
+#endif
     }
 }
 
@@ -1637,6 +1647,8 @@ void WarpX::InitializeEBGridData (int lev)
                     eb_fact, Geom(lev).periodicity() );
             }
 
+            // Boxes fully covered by the EB, in which the update of E is skipped
+            m_eb_no_update_E_box[lev] = warpx::embedded_boundary::FindBoxesWithoutUpdate(m_eb_update_E[lev]);
         }
 
         ComputeDistanceToEB();
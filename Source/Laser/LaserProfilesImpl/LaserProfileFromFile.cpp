@@ -32,9 +32,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <iterator>
 #include <limits>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -93,10 +96,33 @@ WarpXLaserProfiles::FromFileLaserProfile::init (
         m_params.time_chunk_size = min(
         temp, m_params.time_chunk_size);
     }
+    //Read the (optional) prefetching flag and memory budget
+    ppl.query("prefetch_time_chunks", m_prefetch.enabled);
+    if (m_prefetch.enabled && m_params.file_in_lasy_format) {
+        // lasy files are read through openPMD, which is not thread-safe
+        // and is also used by the diagnostics
+        ablastr::warn_manager::WMRecordWarning("Laser",
+            "prefetch_time_chunks is only supported for binary files: "
+            "the time chunks of the lasy file are read when they are needed.",
+            ablastr::warn_manager::WarnPriority::low);
+        m_prefetch.enabled = false;
+    }
+    double memory_budget = 0.;
+    if(utils::parser::queryWithParser(ppl, "time_chunk_memory_budget", memory_budget)){
+        // Two chunks are held in device memory when prefetching
+        const auto n_buffers = m_prefetch.enabled ? 2 : 1;
+        const auto bytes_per_timestep = static_cast<double>(m_params.file_in_lasy_format ?
+            sizeof(Complex)*chunk_data_size(0, 0) : sizeof(amrex::Real)*chunk_data_size(0, 0));
+        const auto max_chunk_size = static_cast<int>(std::min(
+            memory_budget/(n_buffers*bytes_per_timestep), static_cast<double>(m_params.nt)));
+        m_params.time_chunk_size = min(m_params.time_chunk_size, max_chunk_size);
+    }
     if(m_params.time_chunk_size < 2){
         WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_params.time_chunk_size >= 2,
-        "Error! time_chunk_size must be >= 2!");
+        "Error! time_chunk_size must be >= 2! (possibly due to time_chunk_memory_budget)");
     }
+    //Prefetching is only useful if the file is read in several chunks
+    m_prefetch.enabled = m_prefetch.enabled && (m_params.time_chunk_size < m_params.nt);
     //Reads the (optional) delay
     utils::parser::queryWithParser(ppl, "delay", m_params.t_delay);
 
@@ -120,8 +146,26 @@ WarpXLaserProfiles::FromFileLaserProfile::update (amrex::Real t)
     const auto idx_times = find_left_right_time_indices(t);
     const auto idx_t_left = idx_times.first;
     const auto idx_t_right = idx_times.second;
+    //Distribute the prefetched data chunk once half of the current chunk is used,
+    //so that the background read has (ideally) completed
+    if (m_prefetch.first_time_index >= 0 &&
+        2*idx_t_right >= m_params.first_time_index + m_params.last_time_index) {
+        distribute_prefetch();
+    }
     //Load data chunk if needed
     if(idx_t_right >  m_params.last_time_index){
+        if (m_prefetch.distributed &&
+            idx_t_left >= m_prefetch.first_time_index &&
+            idx_t_right <= m_prefetch.last_time_index){
+            //Swap in the prefetched chunk and start reading the next one
+            m_params.E_binary_data.swap(m_prefetch.E_binary_data);
+            m_params.first_time_index = m_prefetch.first_time_index;
+            m_params.last_time_index = m_prefetch.last_time_index;
+            start_prefetch();
+            return;
+        }
+        //The simulation time jumped beyond the prefetched chunk
+        discard_prefetch();
         if (m_params.file_in_lasy_format){
             read_data_t_chunk(idx_t_left, idx_t_left+m_params.time_chunk_size);
         } else{
@@ -241,7 +285,7 @@ WarpXLaserProfiles::FromFileLaserProfile::parse_binary_file (const std::string&
 {
     if(ParallelDescriptor::IOProcessor()){
         std::ifstream inp(binary_file_name, std::ios::binary);
-        if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to open binary file"); }
+        if(!inp) { throw std::runtime_error("Failed to open binary file " + m_params.binary_file_name); }
         inp.exceptions(std::ios_base::failbit | std::ios_base::badbit);
         //Uniform grid flag
         char flag;
@@ -309,119 +353,202 @@ WarpXLaserProfiles::FromFileLaserProfile::find_left_right_time_indices(amrex::Re
     return std::make_pair(idx_t_right-1, idx_t_right);
 }
 
+namespace
+{
+    /** Broadcast a host buffer filled on the IO processor and copy it to a device buffer */
+    template <typename T>
+    void
+    broadcast_to_device (amrex::Vector<T>& h_data, amrex::Gpu::DeviceVector<T>& d_data)
+    {
+        ParallelDescriptor::Bcast(h_data.dataPtr(),
+            h_data.size(), ParallelDescriptor::IOProcessorNumber());
+        d_data.resize(h_data.size());
+        Gpu::copyAsync(Gpu::hostToDevice,h_data.begin(),h_data.end(),d_data.begin());
+        Gpu::synchronize();
+    }
+}
+
+int
+WarpXLaserProfiles::FromFileLaserProfile::chunk_data_size (int i_first, int i_last) const
+{
+    if (m_params.file_in_lasy_format && m_params.file_in_cartesian_geom==0) {
+        return m_params.n_rz_azimuthal_components*(i_last-i_first+1)*m_params.nr;
+    }
+    return (i_last-i_first+1)*m_params.nx*m_params.ny;
+}
+
 void
 WarpXLaserProfiles::FromFileLaserProfile::read_data_t_chunk (int t_begin, int t_end)
 {
 #ifdef WARPX_USE_OPENPMD
     //Indices of the first and last timestep to read
-    auto const i_first = static_cast<long unsigned int>(max(0, t_begin));
-    auto const i_last = static_cast<long unsigned int>(min(t_end-1, m_params.nt-1));
+    auto const i_first = max(0, t_begin);
+    auto const i_last = min(t_end-1, m_params.nt-1);
     amrex::Print() << Utils::TextMsg::Info(
         "Reading [" + std::to_string(i_first) + ", " + std::to_string(i_last) +
             "] data chunk from " + m_params.lasy_file_name);
-    const auto data_size =
-        (m_params.file_in_cartesian_geom==0)?
-        (m_params.n_rz_azimuthal_components*(i_last-i_first+1)*m_params.nr) :
-        (i_last-i_first+1)*m_params.nx*m_params.ny;
-    m_params.E_lasy_data.resize(data_size);
-    Vector<Complex> h_E_lasy_data(m_params.E_lasy_data.size());
-    if(ParallelDescriptor::IOProcessor()){
-        auto series = io::Series(m_params.lasy_file_name, io::Access::READ_ONLY);
-        auto i = series.iterations[0];
-        auto E = i.meshes["laserEnvelope"];
-        auto E_laser = E[io::RecordComponent::SCALAR];
-        openPMD:: Extent full_extent = E_laser.getExtent();
-        if (m_params.file_in_cartesian_geom==0) {
-            const openPMD::Extent read_extent = { full_extent[0], (i_last - i_first + 1), full_extent[2]};
-            auto r_data = E_laser.loadChunk< std::complex<double> >(io::Offset{ 0, i_first,  0}, read_extent);
-            const auto read_size = (i_last - i_first + 1)*m_params.nr;
-            series.flush();
-            for (int m=0; m<m_params.n_rz_azimuthal_components; m++){
-                for (auto j=0u; j<read_size; j++) {
-                    h_E_lasy_data[j+m*read_size] = Complex{
-                        static_cast<amrex::Real>(r_data.get()[j+m*read_size].real()),
-                        static_cast<amrex::Real>(r_data.get()[j+m*read_size].imag())};
-                }
-            }
-        } else{
-            const openPMD::Extent read_extent = {(i_last - i_first + 1), full_extent[1], full_extent[2]};
-            auto x_data = E_laser.loadChunk< std::complex<double> >(io::Offset{i_first, 0, 0}, read_extent);
-            const auto read_size = (i_last - i_first + 1)*m_params.nx*m_params.ny;
-            series.flush();
-            for (auto j=0u; j<read_size; j++) {
-                h_E_lasy_data[j] = Complex{
-                    static_cast<amrex::Real>(x_data.get()[j].real()),
-                    static_cast<amrex::Real>(x_data.get()[j].imag())};
-            }
-        }
-    }
+    Vector<Complex> h_E_lasy_data = ParallelDescriptor::IOProcessor() ?
+        load_lasy_t_chunk(i_first, i_last) : Vector<Complex>(chunk_data_size(i_first, i_last));
     //Broadcast E_lasy_data
-    ParallelDescriptor::Bcast(h_E_lasy_data.dataPtr(),
-        h_E_lasy_data.size(), ParallelDescriptor::IOProcessorNumber());
-    Gpu::copyAsync(Gpu::hostToDevice,h_E_lasy_data.begin(),h_E_lasy_data.end(),m_params.E_lasy_data.begin());
-    Gpu::synchronize();
+    broadcast_to_device(h_E_lasy_data, m_params.E_lasy_data);
     //Update first and last indices
-    m_params.first_time_index = static_cast<int>(i_first);
-    m_params.last_time_index = static_cast<int>(i_last);
+    m_params.first_time_index = i_first;
+    m_params.last_time_index = i_last;
+    start_prefetch();
 #else
     amrex::ignore_unused(t_begin, t_end);
 #endif
 }
 
+amrex::Vector<Complex>
+WarpXLaserProfiles::FromFileLaserProfile::load_lasy_t_chunk (int i_first, int i_last) const
+{
+    Vector<Complex> h_E_lasy_data(chunk_data_size(i_first, i_last));
+#ifdef WARPX_USE_OPENPMD
+    auto const offset_t = static_cast<long unsigned int>(i_first);
+    auto const n_t = static_cast<long unsigned int>(i_last - i_first + 1);
+    auto series = io::Series(m_params.lasy_file_name, io::Access::READ_ONLY);
+    auto i = series.iterations[0];
+    auto E = i.meshes["laserEnvelope"];
+    auto E_laser = E[io::RecordComponent::SCALAR];
+    openPMD:: Extent full_extent = E_laser.getExtent();
+    if (m_params.file_in_cartesian_geom==0) {
+        const openPMD::Extent read_extent = { full_extent[0], n_t, full_extent[2]};
+        auto r_data = E_laser.loadChunk< std::complex<double> >(io::Offset{ 0, offset_t,  0}, read_extent);
+        const auto read_size = n_t*m_params.nr;
+        series.flush();
+        for (int m=0; m<m_params.n_rz_azimuthal_components; m++){
+            for (auto j=0u; j<read_size; j++) {
+                h_E_lasy_data[j+m*read_size] = Complex{
+                    static_cast<amrex::Real>(r_data.get()[j+m*read_size].real()),
+                    static_cast<amrex::Real>(r_data.get()[j+m*read_size].imag())};
+            }
+        }
+    } else{
+        const openPMD::Extent read_extent = {n_t, full_extent[1], full_extent[2]};
+        auto x_data = E_laser.loadChunk< std::complex<double> >(io::Offset{offset_t, 0, 0}, read_extent);
+        const auto read_size = n_t*m_params.nx*m_params.ny;
+        series.flush();
+        for (auto j=0u; j<read_size; j++) {
+            h_E_lasy_data[j] = Complex{
+                static_cast<amrex::Real>(x_data.get()[j].real()),
+                static_cast<amrex::Real>(x_data.get()[j].imag())};
+        }
+    }
+#endif
+    return h_E_lasy_data;
+}
+
 void
 WarpXLaserProfiles::FromFileLaserProfile::read_binary_data_t_chunk (int t_begin, int t_end)
 {
-    amrex::Print() << Utils::TextMsg::Info(
-        "Reading [" + std::to_string(t_begin) + ", " + std::to_string(t_end) +
-            "] data chunk from " + m_params.binary_file_name);
-
     //Indices of the first and last timestep to read
     auto i_first = max(0, t_begin);
     auto i_last = min(t_end-1, m_params.nt-1);
-    const int data_size = (i_last-i_first+1)*m_params.nx*m_params.ny;
-    m_params.E_binary_data.resize(data_size);
-    Vector<Real> h_E_binary_data(m_params.E_binary_data.size());
-    if(ParallelDescriptor::IOProcessor()){
-        //Read data chunk
-        std::ifstream inp(m_params.binary_file_name, std::ios::binary);
-        if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to open binary file"); }
-        inp.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+    amrex::Print() << Utils::TextMsg::Info(
+        "Reading [" + std::to_string(i_first) + ", " + std::to_string(i_last) +
+            "] data chunk from " + m_params.binary_file_name);
+    Vector<Real> h_E_binary_data(chunk_data_size(i_first, i_last));
+    if (ParallelDescriptor::IOProcessor()) {
+        try {
+            h_E_binary_data = load_binary_t_chunk(i_first, i_last);
+        } catch (std::exception const& e) {
+            WARPX_ABORT_WITH_MESSAGE(e.what());
+        }
+    }
+
+    //Broadcast E_binary_data
+    broadcast_to_device(h_E_binary_data, m_params.E_binary_data);
+
+    //Update first and last indices
+    m_params.first_time_index = i_first;
+    m_params.last_time_index = i_last;
+    start_prefetch();
+}
+
+amrex::Vector<amrex::Real>
+WarpXLaserProfiles::FromFileLaserProfile::load_binary_t_chunk (int i_first, int i_last) const
+{
+    Vector<Real> h_E_binary_data(chunk_data_size(i_first, i_last));
+    //Read data chunk
+    std::ifstream inp(m_params.binary_file_name, std::ios::binary);
+    if(!inp) { throw std::runtime_error("Failed to open binary file " + m_params.binary_file_name); }
+    inp.exceptions(std::ios_base::failbit | std::ios_base::badbit);
 #if (defined(WARPX_DIM_3D))
-        auto skip_amount = 1 +
-        3*sizeof(uint32_t) +
-        2*sizeof(double) +
-        2*sizeof(double) +
-        2*sizeof(double) +
-        sizeof(double)*t_begin*m_params.nx*m_params.ny;
+    auto skip_amount = 1 +
+    3*sizeof(uint32_t) +
+    2*sizeof(double) +
+    2*sizeof(double) +
+    2*sizeof(double) +
+    sizeof(double)*i_first*m_params.nx*m_params.ny;
 #else
-        auto skip_amount = 1 +
-        3*sizeof(uint32_t) +
-        2*sizeof(double) +
-        2*sizeof(double) +
-        1*sizeof(double) +
-        sizeof(double)*t_begin*m_params.nx*m_params.ny;
+    auto skip_amount = 1 +
+    3*sizeof(uint32_t) +
+    2*sizeof(double) +
+    2*sizeof(double) +
+    1*sizeof(double) +
+    sizeof(double)*i_first*m_params.nx*m_params.ny;
 #endif
-        inp.seekg(static_cast<std::streamoff>(skip_amount));
-        if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to read field data from binary file"); }
-        const int read_size = (i_last - i_first + 1)*
-            m_params.nx*m_params.ny;
-        Vector<double> buf_e(read_size);
-        inp.read(reinterpret_cast<char*>(buf_e.dataPtr()), static_cast<std::streamsize>(read_size*sizeof(double)));
-        if(!inp) { WARPX_ABORT_WITH_MESSAGE("Failed to read field data from binary file"); }
-        std::transform(buf_e.begin(), buf_e.end(), h_E_binary_data.begin(),
-            [](auto x) {return static_cast<amrex::Real>(x);} );
-    }
+    inp.seekg(static_cast<std::streamoff>(skip_amount));
+    if(!inp) { throw std::runtime_error("Failed to read field data from binary file " + m_params.binary_file_name); }
+    const int read_size = (i_last - i_first + 1)*
+        m_params.nx*m_params.ny;
+    Vector<double> buf_e(read_size);
+    inp.read(reinterpret_cast<char*>(buf_e.dataPtr()), static_cast<std::streamsize>(read_size*sizeof(double)));
+    if(!inp) { throw std::runtime_error("Failed to read field data from binary file " + m_params.binary_file_name); }
+    std::transform(buf_e.begin(), buf_e.end(), h_E_binary_data.begin(),
+        [](auto x) {return static_cast<amrex::Real>(x);} );
+    return h_E_binary_data;
+}
 
-    //Broadcast E_binary_data
-    ParallelDescriptor::Bcast(h_E_binary_data.dataPtr(),
-        h_E_binary_data.size(), ParallelDescriptor::IOProcessorNumber());
+void
+WarpXLaserProfiles::FromFileLaserProfile::start_prefetch ()
+{
+    discard_prefetch();
+    // The next chunk starts at the last timestep in memory, which is needed
+    // for the interpolation between the two chunks
+    if (!m_prefetch.enabled || m_params.last_time_index >= m_params.nt-1) { return; }
+    auto const i_first = m_params.last_time_index;
+    auto const i_last = min(i_first+m_params.time_chunk_size-1, m_params.nt-1);
+    m_prefetch.first_time_index = i_first;
+    m_prefetch.last_time_index = i_last;
+    m_prefetch.distributed = false;
+    amrex::Print() << Utils::TextMsg::Info(
+        "Prefetching [" + std::to_string(i_first) + ", " + std::to_string(i_last) + "] data chunk");
+    if (ParallelDescriptor::IOProcessor()) {
+        // The binary file is read with the standard library only, in a background thread
+        m_prefetch.binary_read = std::async(std::launch::async,
+            [this, i_first, i_last] () { return load_binary_t_chunk(i_first, i_last); });
+    }
+}
 
-    Gpu::copyAsync(Gpu::hostToDevice,h_E_binary_data.begin(),h_E_binary_data.end(),m_params.E_binary_data.begin());
-    Gpu::synchronize();
+void
+WarpXLaserProfiles::FromFileLaserProfile::distribute_prefetch ()
+{
+    if (m_prefetch.first_time_index < 0 || m_prefetch.distributed) { return; }
+    auto const i_first = m_prefetch.first_time_index;
+    auto const i_last = m_prefetch.last_time_index;
+    Vector<Real> h_E_binary_data(chunk_data_size(i_first, i_last));
+    if (ParallelDescriptor::IOProcessor()) {
+        // Errors of the background read are rethrown here, on the main thread
+        try {
+            h_E_binary_data = m_prefetch.binary_read.get();
+        } catch (std::exception const& e) {
+            WARPX_ABORT_WITH_MESSAGE(e.what());
+        }
+    }
+    broadcast_to_device(h_E_binary_data, m_prefetch.E_binary_data);
+    m_prefetch.distributed = true;
+}
 
-    //Update first and last indices
-    m_params.first_time_index = static_cast<int>(i_first);
-    m_params.last_time_index = static_cast<int>(i_last);
+void
+WarpXLaserProfiles::FromFileLaserProfile::discard_prefetch ()
+{
+    if (m_prefetch.binary_read.valid()) { m_prefetch.binary_read.wait(); }
+    m_prefetch.binary_read = std::future<Vector<Real>>{};
+    m_prefetch.first_time_index = -1;
+    m_prefetch.last_time_index = -1;
+    m_prefetch.distributed = false;
 }
 
 void
@@ -84,42 +84,29 @@ WarpXLaserProfiles::GaussianLaserProfile::init (
 
 }
 
-/* \brief compute field amplitude for a Gaussian laser, at particles' position
- *
- * Both Xp and Yp are given in laser plane coordinate.
- * For each particle with position Xp and Yp, this routine computes the
- * amplitude of the laser electric field, stored in array amplitude.
- *
- * \param np: number of laser particles
- * \param Xp: pointer to first component of positions of laser particles
- * \param Yp: pointer to second component of positions of laser particles
- * \param t: Current physical time
- * \param amplitude: pointer to array of field amplitude.
- */
-void
-WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude (
-    const int np, Real const * AMREX_RESTRICT const Xp, Real const * AMREX_RESTRICT const Yp,
-    Real t, Real * AMREX_RESTRICT const amplitude) const
+WarpXLaserProfiles::GaussianLaserProfile::Factors
+WarpXLaserProfiles::GaussianLaserProfile::compute_factors (Real t) const
 {
     const Complex I(0,1);
+    Factors f;
     // Calculate a few factors which are independent of the macroparticle
-    const Real k0 = 2._rt*MathConst::pi/m_common_params.wavelength;
-    const Real inv_tau2 = 1._rt /(m_params.duration * m_params.duration);
-    const Real oscillation_phase = k0 * PhysConst::c * ( t - m_params.t_peak ) + m_params.phi0;
+    f.k0 = 2._rt*MathConst::pi/m_common_params.wavelength;
+    f.inv_tau2 = 1._rt /(m_params.duration * m_params.duration);
+    const Real oscillation_phase = f.k0 * PhysConst::c * ( t - m_params.t_peak ) + m_params.phi0;
     // The coefficients below contain info about Gouy phase,
     // laser diffraction, and phase front curvature
     const Complex diffract_factor =
         1._rt + I * m_params.focal_distance * 2._rt/
-        ( k0 * m_params.waist * m_params.waist );
-    const Complex inv_complex_waist_2 =
+        ( f.k0 * m_params.waist * m_params.waist );
+    f.inv_complex_waist_2 =
         1._rt /(m_params.waist*m_params.waist * diffract_factor );
 
     // Time stretching due to STCs and phi2 complex envelope
     // (1 if zeta=0, beta=0, phi2=0)
-    const Complex stretch_factor = 1._rt + 4._rt *
-        ((m_params.zeta+m_params.beta*m_params.focal_distance)*inv_tau2)
-        * ((m_params.zeta+m_params.beta*m_params.focal_distance)*inv_complex_waist_2)
-        + 2._rt*I*(m_params.phi2-m_params.beta*m_params.beta*k0*m_params.focal_distance)*inv_tau2;
+    f.stretch_factor = 1._rt + 4._rt *
+        ((m_params.zeta+m_params.beta*m_params.focal_distance)*f.inv_tau2)
+        * ((m_params.zeta+m_params.beta*m_params.focal_distance)*f.inv_complex_waist_2)
+        + 2._rt*I*(m_params.phi2-m_params.beta*m_params.beta*f.k0*m_params.focal_distance)*f.inv_tau2;
 
     // Amplitude and monochromatic oscillations
     const Complex t_prefactor =
@@ -129,12 +116,95 @@ WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude (
     // account the impact of the dimensionality on both the Gouy phase
     // and the amplitude of the laser
 #if (defined(WARPX_DIM_3D) || (defined WARPX_DIM_RZ))
-    const Complex prefactor = t_prefactor / diffract_factor;
+    f.prefactor = t_prefactor / diffract_factor;
 #elif defined(WARPX_DIM_XZ)
-    const Complex prefactor = t_prefactor / amrex::sqrt(diffract_factor);
+    f.prefactor = t_prefactor / amrex::sqrt(diffract_factor);
 #else
-    const Complex prefactor = t_prefactor;
+    f.prefactor = t_prefactor;
 #endif
+    return f;
+}
+
+/* \brief compute the temporal factor of a Gaussian laser without STCs
+ *
+ * Without STCs, the exponent of the temporal envelope does not depend on the
+ * position in the antenna plane, so that the amplitude is the real part of
+ * the product of this factor with the complex transverse envelope.
+ *
+ * \param t: Current physical time
+ */
+Complex
+WarpXLaserProfiles::GaussianLaserProfile::temporal_factor (Real t) const
+{
+    const Factors f = compute_factors(t);
+    const Complex stc_exponent = 1._rt / f.stretch_factor * f.inv_tau2 *
+        amrex::pow(Complex{t - m_params.t_peak, 0._rt}, 2);
+    return f.prefactor * amrex::exp( - stc_exponent );
+}
+
+/* \brief compute the complex transverse envelope of a Gaussian laser without STCs
+ *
+ * \param np: number of laser particles
+ * \param Xp: pointer to first component of positions of laser particles
+ * \param Yp: pointer to second component of positions of laser particles
+ * \param transverse_re: pointer to the real part of the transverse envelope
+ * \param transverse_im: pointer to the imaginary part of the transverse envelope
+ */
+void
+WarpXLaserProfiles::GaussianLaserProfile::fill_transverse_factor (
+    const int np, Real const * AMREX_RESTRICT const Xp, Real const * AMREX_RESTRICT const Yp,
+    Real * AMREX_RESTRICT const transverse_re, Real * AMREX_RESTRICT const transverse_im) const
+{
+    // The transverse envelope does not depend on time
+    const Complex inv_complex_waist_2 = compute_factors(0._rt).inv_complex_waist_2;
+    amrex::ParallelFor(
+        np,
+        [=] AMREX_GPU_DEVICE (int i) {
+            const Complex transverse = amrex::exp( - ( Xp[i]*Xp[i] + Yp[i]*Yp[i] ) * inv_complex_waist_2 );
+            transverse_re[i] = transverse.real();
+            transverse_im[i] = transverse.imag();
+        }
+        );
+}
+
+/* \brief compute field amplitude for a Gaussian laser, at particles' position
+ *
+ * Both Xp and Yp are given in laser plane coordinate.
+ * For each particle with position Xp and Yp, this routine computes the
+ * amplitude of the laser electric field, stored in array amplitude.
+ *
+ * \param np: number of laser particles
+ * \param Xp: pointer to first component of positions of laser particles
+ * \param Yp: pointer to second component of positions of laser particles
+ * \param t: Current physical time
+ * \param amplitude: pointer to array of field amplitude.
+ */
+void
+WarpXLaserProfiles::GaussianLaserProfile::fill_amplitude (
+    const int np, Real const * AMREX_RESTRICT const Xp, Real const * AMREX_RESTRICT const Yp,
+    Real t, Real * AMREX_RESTRICT const amplitude) const
+{
+    const Complex I(0,1);
+    const Factors f = compute_factors(t);
+    const Real k0 = f.k0;
+    const Real inv_tau2 = f.inv_tau2;
+    const Complex inv_complex_waist_2 = f.inv_complex_waist_2;
+    const Complex stretch_factor = f.stretch_factor;
+    const Complex prefactor = f.prefactor;
+
+    // Without STCs, the temporal envelope is the same for all the particles:
+    // compute it once, and only evaluate the transverse envelope per particle
+    if (is_separable()) {
+        const Complex t_factor = temporal_factor(t);
+        amrex::ParallelFor(
+            np,
+            [=] AMREX_GPU_DEVICE (int i) {
+                const Complex exp_argument = - ( Xp[i]*Xp[i] + Yp[i]*Yp[i] ) * inv_complex_waist_2;
+                amplitude[i] = ( t_factor * amrex::exp( exp_argument ) ).real();
+            }
+            );
+        return;
+    }
 
     // Copy member variables to tmp copies for GPU runs.
     auto const tmp_profile_t_peak = m_params.t_peak;
@@ -14,6 +14,9 @@
 #endif
 #include "Fields.H"
 #include "Filter/BilinearFilter.H"
+#ifdef WARPX_USE_FFT
+#   include "Filter/KSpaceBinomialFilter.H"
+#endif
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "WarpXComm_K.H"
@@ -1294,11 +1297,15 @@ WarpX::SyncCurrent (const std::string& current_fp_string)
                 }
             }
 
-            if (use_filter)
+            if (use_filter && !filter_current_in_kspace)
             {
                 ApplyFilterJ(J_fp, lev, idim);
             }
             SumBoundaryJ(J_fp, lev, idim, period);
+            if (use_filter && filter_current_in_kspace)
+            {
+                ApplyKSpaceFilterJ(J_fp, lev, idim, period);
+            }
         }
     }
 }
@@ -1662,6 +1669,33 @@ void WarpX::ApplyFilterJ (
     }
 }
 
+void WarpX::ApplyKSpaceFilterJ (
+    const ablastr::fields::MultiLevelVectorField& current,
+    const int lev,
+    const int idim,
+    const amrex::Periodicity& period)
+{
+    using ablastr::fields::Direction;
+    ApplyKSpaceFilterMF(*current[lev][Direction{idim}], lev, period);
+}
+
+void WarpX::ApplyKSpaceFilterMF (
+    amrex::MultiFab& mf,
+    const int lev,
+    const amrex::Periodicity& period)
+{
+#ifdef WARPX_USE_FFT
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(kspace_binomial_filter,
+        "ApplyKSpaceFilterMF: the k-space filter was not initialized");
+
+    kspace_binomial_filter->Apply(mf, Geom(lev).Domain());
+    ablastr::utils::communication::FillBoundary(mf, do_single_precision_comms, period);
+#else
+    amrex::ignore_unused(mf, lev, period);
+    WARPX_ABORT_WITH_MESSAGE("ApplyKSpaceFilterMF: WarpX was not compiled with FFT support");
+#endif
+}
+
 void WarpX::SumBoundaryJ (
     const ablastr::fields::MultiLevelVectorField& current,
     const int lev,
@@ -1737,11 +1771,18 @@ void WarpX::AddCurrentFromFineLevelandSumBoundary (
 {
     const amrex::Periodicity& period = Geom(lev).periodicity();
 
-    if (use_filter)
+    if (use_filter && !filter_current_in_kspace)
     {
         ApplyFilterJ(J_fp, lev);
     }
     SumBoundaryJ(J_fp, lev, period);
+    if (use_filter && filter_current_in_kspace)
+    {
+        for (int idim=0; idim<3; ++idim)
+        {
+            ApplyKSpaceFilterJ(J_fp, lev, idim, period);
+        }
+    }
 
     if (lev < finest_level)
     {
@@ -1836,7 +1877,14 @@ void WarpX::ApplyFilterandSumBoundaryRho (int /*lev*/, int glev, amrex::MultiFab
     const amrex::Periodicity& period = Geom(glev).periodicity();
     IntVect ng = rho.nGrowVect();
     IntVect ng_depos_rho = get_ng_depos_rho();
-    if (use_filter) {
+    if (use_filter && filter_current_in_kspace) {
+        // Filter with the same transfer function as the current density,
+        // after the guard cells have been summed (see SyncCurrent)
+        ng_depos_rho.min(ng);
+        WarpXSumGuardCells(rho, period, ng_depos_rho, icomp, ncomp);
+        MultiFab rho_comps(rho, amrex::make_alias, icomp, ncomp);
+        ApplyKSpaceFilterMF(rho_comps, glev, period);
+    } else if (use_filter) {
         ng += bilinear_filter.stencil_length_each_dir-1;
         ng_depos_rho += bilinear_filter.stencil_length_each_dir-1;
         ng_depos_rho.min(ng);
@@ -41,6 +41,7 @@
 #include <AMReX_ParallelContext.H>
 #include <AMReX_ParallelDescriptor.H>
 #include <AMReX_REAL.H>
+#include <AMReX_Reduce.H>
 #include <AMReX_Vector.H>
 #include <AMReX_iMultiFab.H>
 
@@ -347,6 +348,7 @@ WarpX::RemakeLevel (int lev, Real /*time*/, const BoxArray& ba, const Distributi
 void
 WarpX::ComputeCostsHeuristic (amrex::Vector<std::unique_ptr<amrex::LayoutData<amrex::Real> > >& a_costs)
 {
+    using namespace amrex::literals;
     using ablastr::fields::Direction;
     using warpx::fields::FieldType;
 
@@ -367,12 +369,35 @@ WarpX::ComputeCostsHeuristic (amrex::Vector<std::unique_ptr<amrex::LayoutData<am
             }
         }
 
+        // With embedded boundaries, only count the fraction of the box that is
+        // outside of the EB (estimated from the nodes of the signed distance)
+        MultiFab const* distance_to_eb = nullptr;
+        if (EB::enabled() && costs_heuristic_eb_weighting &&
+            m_fields.has(FieldType::distance_to_eb, lev)) {
+            distance_to_eb = m_fields.get(FieldType::distance_to_eb, lev);
+        }
+
         // Cell loop
         MultiFab* Ex = m_fields.get(FieldType::Efield_fp, Direction{0}, lev);
         for (MFIter mfi(*Ex, false); mfi.isValid(); ++mfi)
         {
             const Box& gbx = mfi.growntilebox();
-            (*a_costs[lev])[mfi.index()] += costs_heuristic_cells_wt*gbx.numPts();
+            amrex::Real uncovered_fraction = 1.0_rt;
+            if (distance_to_eb) {
+                const Box& nbx = distance_to_eb->box(mfi.index());
+                amrex::Array4<amrex::Real const> const& dist = distance_to_eb->const_array(mfi);
+                amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+                amrex::ReduceData<amrex::Long> reduce_data(reduce_op);
+                using ReduceTuple = typename decltype(reduce_data)::Type;
+                reduce_op.eval(nbx, reduce_data,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
+                    {
+                        return {(dist(i,j,k) >= 0.0_rt) ? 1 : 0};
+                    });
+                uncovered_fraction = static_cast<amrex::Real>(amrex::get<0>(reduce_data.value(reduce_op)))
+                    / static_cast<amrex::Real>(nbx.numPts());
+            }
+            (*a_costs[lev])[mfi.index()] += costs_heuristic_cells_wt*uncovered_fraction*gbx.numPts();
         }
     }
 }
@@ -46,6 +46,7 @@
 #include <AMReX_Print.H>
 #include <AMReX_REAL.H>
 #include <AMReX_RealBox.H>
+#include <AMReX_Reduce.H>
 #include <AMReX_StructOfArrays.H>
 #include <AMReX_Utility.H>
 #include <AMReX_Vector.H>
@@ -123,6 +124,7 @@ LaserParticleContainer::LaserParticleContainer (AmrCore* amr_core, int ispecies,
         );
 
     pp_laser_name.query("do_continuous_injection", do_continuous_injection);
+    pp_laser_name.query("cache_transverse_profile", m_cache_transverse_profile);
     utils::parser::queryWithParser(pp_laser_name,
         "min_particles_per_mode", m_min_particles_per_mode);
 
@@ -275,6 +277,11 @@ LaserParticleContainer::LaserParticleContainer (AmrCore* amr_core, int ispecies,
     common_params.p_X = m_p_X;
     common_params.nvec = m_nvec;
     m_up_laser_profile->init(pp_laser_name, common_params);
+
+    WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+        !m_cache_transverse_profile || m_up_laser_profile->is_separable(),
+        m_laser_name + ".cache_transverse_profile requires a separable laser profile "
+        "(gaussian without spatio-temporal couplings)");
 }
 
 /* \brief Check if laser particles enter the box, and inject if necessary.
@@ -593,6 +600,26 @@ LaserParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
     const bool has_rho = fields.has(FieldType::rho_fp, lev);
     const bool has_buffer = fields.has_vector(FieldType::current_buf, lev);
 
+    // With a cached transverse profile, only the temporal factor is evaluated at each step.
+    // The cache entries are created (and those of tiles that no longer exist removed)
+    // here, so that the map is not modified in the parallel region below.
+    Complex temporal_factor{0, 0};
+    if (m_cache_transverse_profile) {
+        temporal_factor = m_up_laser_profile->temporal_factor(t_lab);
+        if (static_cast<int>(m_transverse_cache.size()) <= lev) { m_transverse_cache.resize(lev+1); }
+        std::map<std::pair<int,int>, TransverseFactorCache> cache;
+        for (WarpXParIter pti(*this, lev); pti.isValid(); ++pti) {
+            auto const key = std::make_pair(pti.index(), pti.LocalTileIndex());
+            auto it = m_transverse_cache[lev].find(key);
+            if (it != m_transverse_cache[lev].end()) {
+                cache.emplace(key, std::move(it->second));
+            } else {
+                cache.emplace(key, TransverseFactorCache{});
+            }
+        }
+        m_transverse_cache[lev] = std::move(cache);
+    }
+
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -654,9 +681,15 @@ LaserParticleContainer::Evolve (ablastr::fields::MultiFabRegister& fields,
 
             // Calculate the laser amplitude to be emitted,
             // at the position of the emission plane
-            m_up_laser_profile->fill_amplitude(
-                static_cast<int>(np), plane_Xp.dataPtr(), plane_Yp.dataPtr(),
-                t_lab, amplitude_E.dataPtr());
+            if (m_cache_transverse_profile) {
+                fill_amplitude_from_cache(pti, static_cast<int>(np),
+                    m_transverse_cache[lev].at(std::make_pair(pti.index(), pti.LocalTileIndex())),
+                    temporal_factor, plane_Xp.dataPtr(), plane_Yp.dataPtr(), amplitude_E.dataPtr());
+            } else {
+                m_up_laser_profile->fill_amplitude(
+                    static_cast<int>(np), plane_Xp.dataPtr(), plane_Yp.dataPtr(),
+                    t_lab, amplitude_E.dataPtr());
+            }
 
             // Calculate the corresponding momentum and position for the particles
             update_laser_particle(pti, static_cast<int>(np), uxp.dataPtr(), uyp.dataPtr(),
@@ -845,6 +878,65 @@ LaserParticleContainer::calculate_laser_plane_coordinates (const WarpXParIter& p
         );
 }
 
+/* \brief compute the laser amplitude of a separable profile from the cached
+ * transverse factor of the particles of one tile.
+ *
+ * The transverse factor is recomputed, at the current positions of the particles
+ * in the laser plane, if the ids of the particles of the tile changed.
+ *
+ * \param np: number of laser particles
+ * \param cache: cached transverse factor of the tile
+ * \param temporal_factor: complex temporal factor of the profile at the current time
+ * \param pplane_Xp, pplane_Yp: pointers to arrays of particle positions
+ * in laser plane coordinate.
+ * \param amplitude: pointer to array of field amplitude.
+ */
+void
+LaserParticleContainer::fill_amplitude_from_cache (const WarpXParIter& pti, const int np,
+                                                   TransverseFactorCache& cache,
+                                                   Complex const temporal_factor,
+                                                   Real * AMREX_RESTRICT const pplane_Xp,
+                                                   Real * AMREX_RESTRICT const pplane_Yp,
+                                                   Real * AMREX_RESTRICT const amplitude)
+{
+    auto const * AMREX_RESTRICT idcpu = pti.GetStructOfArrays().GetIdCPUData().data();
+
+    bool valid = (static_cast<int>(cache.idcpu.size()) == np);
+    if (valid && np > 0) {
+        auto const * AMREX_RESTRICT cached_idcpu = cache.idcpu.dataPtr();
+        amrex::ReduceOps<amrex::ReduceOpMax> reduce_op;
+        amrex::ReduceData<int> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+        reduce_op.eval(np, reduce_data,
+            [=] AMREX_GPU_DEVICE (int i) -> ReduceTuple
+            {
+                return {(idcpu[i] != cached_idcpu[i]) ? 1 : 0};
+            });
+        valid = (amrex::get<0>(reduce_data.value(reduce_op)) == 0);
+    }
+
+    if (!valid) {
+        cache.idcpu.resize(np);
+        cache.re.resize(np);
+        cache.im.resize(np);
+        auto * AMREX_RESTRICT cached_idcpu = cache.idcpu.dataPtr();
+        amrex::ParallelFor(np, [=] AMREX_GPU_DEVICE (int i) { cached_idcpu[i] = idcpu[i]; });
+        m_up_laser_profile->fill_transverse_factor(
+            np, pplane_Xp, pplane_Yp, cache.re.dataPtr(), cache.im.dataPtr());
+    }
+
+    auto const * AMREX_RESTRICT re = cache.re.dataPtr();
+    auto const * AMREX_RESTRICT im = cache.im.dataPtr();
+    Real const t_re = temporal_factor.real();
+    Real const t_im = temporal_factor.imag();
+    amrex::ParallelFor(
+        np,
+        [=] AMREX_GPU_DEVICE (int i) {
+            amplitude[i] = t_re*re[i] - t_im*im[i];
+        }
+        );
+}
+
 /* \brief push laser particles, in simulation coordinates.
  *
  * \param pti: Particle iterator
@@ -1245,22 +1245,24 @@ void MultiParticleContainer::CheckIonizationProductSpecies()
 void MultiParticleContainer::ScrapeParticlesAtEB (
     ablastr::fields::MultiLevelScalarField const& distance_to_eb)
 {
+    using warpx::embedded_boundary::MultiLevelEBBoxType;
+    auto& warpx = WarpX::GetInstance();
+    MultiLevelEBBoxType const eb_box_type = warpx.GetEBBoxTypes();
     if (WarpX::eb_particle_boundary == ParticleBoundaryType::Reflecting ||
         WarpX::eb_particle_boundary == ParticleBoundaryType::Thermal) {
-        auto& warpx = WarpX::GetInstance();
         for (auto& pc : allcontainers) {
             amrex::ParticleReal const mass = pc->getMass();
             amrex::ParticleReal const uth = pc->getBoundaryThermalVelocity();
             for (int lev = 0; lev <= pc->finestLevel(); ++lev) {
                 amrex::Real const dt_lev = warpx.getdt(lev);
-                scrapeParticlesAtEB(*pc, distance_to_eb, lev,
+                scrapeParticlesAtEB(*pc, distance_to_eb, eb_box_type, lev,
                     ParticleBoundaryProcess::ParticleBoundaryInteraction{
                         dt_lev, mass, WarpX::eb_particle_boundary, uth});
             }
         }
     } else {
         for (auto& pc : allcontainers) {
-            scrapeParticlesAtEB(*pc, distance_to_eb, ParticleBoundaryProcess::Absorb());
+            scrapeParticlesAtEB(*pc, distance_to_eb, eb_box_type, ParticleBoundaryProcess::Absorb());
         }
     }
 }
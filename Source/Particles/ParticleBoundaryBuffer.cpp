@@ -7,6 +7,7 @@
 #include "WarpX.H"
 #include "EmbeddedBoundary/Enabled.H"
 #include "EmbeddedBoundary/DistanceToEB.H"
+#include "EmbeddedBoundary/EBBoxType.H"
 #include "Particles/ParticleBoundaryBuffer.H"
 #include "Particles/MultiParticleContainer.H"
 #include "Utils/TextMsg.H"
@@ -511,6 +512,14 @@ void ParticleBoundaryBuffer::gatherParticlesFromEmbeddedBoundaries (
             {
                 const auto& plevel = pc.GetParticles(lev);
                 auto dxi = warpx_instance.Geom(lev).InvCellSizeArray();
+                // boxes that do not touch the embedded boundary cannot contain scraped particles
+                using warpx::embedded_boundary::EBBoxType;
+                amrex::LayoutData<EBBoxType> const* box_type = warpx_instance.GetEBBoxType(lev);
+                if (box_type != nullptr &&
+                    (box_type->boxArray() != distance_to_eb[lev]->boxArray() ||
+                     box_type->DistributionMap() != distance_to_eb[lev]->DistributionMap())) {
+                    box_type = nullptr;
+                }
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
@@ -518,6 +527,7 @@ void ParticleBoundaryBuffer::gatherParticlesFromEmbeddedBoundaries (
                     auto phiarr = (*distance_to_eb[lev])[pti].array();  // signed distance function
                     auto index = std::make_pair(pti.index(), pti.LocalTileIndex());
                     if (!plevel.contains(index)) { continue; }
+                    if (box_type != nullptr && (*box_type)[pti.index()] == EBBoxType::Regular) { continue; }
 
                     const auto getPosition = GetParticlePosition<PIdx>(pti);
                     auto &ptile_buffer = species_buffer.DefineAndReturnParticleTile(lev, pti.index(),
@@ -809,7 +809,26 @@ PhysicalParticleContainer::AddPlasma (PlasmaInjector& plasma_injector, int lev,
         // Continuous particle injection due to moving window
         const int moving_dir = WarpX::moving_window_dir;
         const int moving_sign = (WarpX::moving_window_v > 0) ? 1 : -1;
-        plasma_injector.prepare(part_realbox, moving_dir, moving_sign, get_zlab);
+        // Only the part of part_realbox covered by the boxes of this process
+        // is needed (e.g. when loading the density from a file)
+        amrex::RealBox local_realbox;
+        for (MFIter mfi = MakeMFIter(lev, MFItInfo{}); mfi.isValid(); ++mfi) {
+            const amrex::RealBox box_realbox(mfi.validbox(), dx.data(), problo.data());
+            amrex::RealBox overlap;
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                overlap.setLo(idim, std::max(box_realbox.lo(idim), part_realbox.lo(idim)));
+                overlap.setHi(idim, std::min(box_realbox.hi(idim), part_realbox.hi(idim)));
+            }
+            if (!overlap.ok()) { continue; }
+            if (local_realbox.ok()) {
+                for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                    overlap.setLo(idim, std::min(overlap.lo(idim), local_realbox.lo(idim)));
+                    overlap.setHi(idim, std::max(overlap.hi(idim), local_realbox.hi(idim)));
+                }
+            }
+            local_realbox = overlap;
+        }
+        plasma_injector.prepare(local_realbox, moving_dir, moving_sign, get_zlab);
     }
 
     MFItInfo info;
@@ -1220,6 +1239,7 @@ PhysicalParticleContainer::AddPlasma (PlasmaInjector& plasma_injector, int lev,
         scrapeParticlesAtEB(
             *this,
             warpx.m_fields.get_mr_levels(FieldType::distance_to_eb, warpx.finestLevel()),
+            warpx.GetEBBoxTypes(),
             ParticleBoundaryProcess::Absorb());
     }
 #endif
@@ -1739,6 +1759,7 @@ PhysicalParticleContainer::AddPlasmaFlux (PlasmaInjector const& plasma_injector,
         scrapeParticlesAtEB(
             tmp_pc,
             warpx.m_fields.get_mr_levels(FieldType::distance_to_eb, warpx.finestLevel()),
+            warpx.GetEBBoxTypes(),
             ParticleBoundaryProcess::Absorb());
     }
 #endif
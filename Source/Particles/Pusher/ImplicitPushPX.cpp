@@ -374,6 +374,10 @@ PhysicalParticleContainer::SetupSuborbitParticles (WarpXParIter & pti,
  *        The routine iterates the advance until the position and velocity pushes
  *        (which depend on each other) are consistent. Any unconverged particles
  *        are flagged for later processing.
+ *        When implicit_options->particle_fast_pass_iterations is set, the iterations
+ *        are done in two passes: a fast pass over all particles, limited to this
+ *        number of iterations, then a pass over a dense list of the particles that
+ *        did not converge yet, which resume their iterations up to the maximum.
  *
  * \param[in] pti The WarpXParIter holding the particles to push
  * \param[in] exfab, eyfab, ezfab The E fields
@@ -554,110 +558,160 @@ PhysicalParticleContainer::ImplicitPushXP (WarpXParIter & pti,
     amrex::Long* unconverged_particles_ptr = unconverged_particles.data();
     int *nsuborbits = (HasiAttrib("nsuborbits") ? pti.GetiAttribs("nsuborbits").dataPtr() + offset: nullptr);
 
-    // Using this version of For with compile time options
-    // improves performance when qed or external EB are not used by reducing
-    // register pressure.
-    // amrex::For: iterations share the unconverged-particles counter
-    // (no SIMD pragma, see issue #7097)
-    amrex::For(amrex::TypeList<amrex::CompileTimeOptions<no_exteb,has_exteb>,
-                               amrex::CompileTimeOptions<no_qed  ,has_qed>>{},
-               {exteb_runtime_flag, qed_runtime_flag},
-               np_to_push, [=] AMREX_GPU_DEVICE (long ip, auto exteb_control,
-                                                 auto qed_control)
-    {
-
-        // Skip any particles that require suborbits
-        if (nsuborbits && nsuborbits[ip] > 1) {
-            // write signaling flag: how many particles did not converge?
-            amrex::Gpu::Atomic::Add(unconverged_particles_ptr, amrex::Long(1));
-            return;
-        }
+    // With the two-pass scheme, the particles that have not converged after the
+    // fast pass are flagged, then compacted into a dense work list
+    const int fast_pass_iterations = implicit_options->particle_fast_pass_iterations;
+    const bool two_pass = (fast_pass_iterations > 0 && fast_pass_iterations < max_iterations);
+    amrex::Gpu::DeviceVector<int> straggler_flags;
+    amrex::Gpu::DeviceVector<long> straggler_indices;
+    amrex::Gpu::Buffer<amrex::Long> num_stragglers_buffer({0});
+    amrex::Long* num_stragglers_ptr = num_stragglers_buffer.data();
+    if (two_pass) { straggler_flags.resize(np_to_push); }
+
+    for (int pass = 0; pass < (two_pass ? 2 : 1); ++pass) {
+
+        bool const fast_pass = two_pass && (pass == 0);
+        long const num_to_push = (pass == 0) ? np_to_push : static_cast<long>(straggler_indices.size());
+        int const pass_max_iterations = fast_pass ? fast_pass_iterations : max_iterations - fast_pass_iterations;
+        long const * const work_list = (pass == 0) ? nullptr : straggler_indices.data();
+        int * const straggler_flag = fast_pass ? straggler_flags.data() : nullptr;
+
+        // Using this version of For with compile time options
+        // improves performance when qed or external EB are not used by reducing
+        // register pressure.
+        // amrex::For: iterations share the unconverged-particles counter
+        // (no SIMD pragma, see issue #7097)
+        amrex::For(amrex::TypeList<amrex::CompileTimeOptions<no_exteb,has_exteb>,
+                                   amrex::CompileTimeOptions<no_qed  ,has_qed>>{},
+                   {exteb_runtime_flag, qed_runtime_flag},
+                   num_to_push, [=] AMREX_GPU_DEVICE (long i, auto exteb_control,
+                                                      auto qed_control)
+        {
+            const long ip = work_list ? work_list[i] : i;
+            if (straggler_flag) { straggler_flag[ip] = 0; }
+
+            // Skip any particles that require suborbits
+            if (nsuborbits && nsuborbits[ip] > 1) {
+                // write signaling flag: how many particles did not converge?
+                amrex::Gpu::Atomic::Add(unconverged_particles_ptr, amrex::Long(1));
+                return;
+            }
 
 #if !defined(WARPX_DIM_1D_Z)
-        amrex::ParticleReal xp = x_n[ip];
-        const amrex::ParticleReal xp_n = x_n[ip];
+            amrex::ParticleReal xp = x_n[ip];
+            const amrex::ParticleReal xp_n = x_n[ip];
 #else
-        amrex::ParticleReal xp = 0._prt;
-        const amrex::ParticleReal xp_n = 0._prt;
+            amrex::ParticleReal xp = 0._prt;
+            const amrex::ParticleReal xp_n = 0._prt;
 #endif
 #if defined(WARPX_DIM_3D) || defined(WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
-        amrex::ParticleReal yp = y_n[ip];
-        const amrex::ParticleReal yp_n = y_n[ip];
+            amrex::ParticleReal yp = y_n[ip];
+            const amrex::ParticleReal yp_n = y_n[ip];
 #else
-        amrex::ParticleReal yp = 0._prt;
-        const amrex::ParticleReal yp_n = 0._prt;
+            amrex::ParticleReal yp = 0._prt;
+            const amrex::ParticleReal yp_n = 0._prt;
 #endif
 #if !defined(WARPX_DIM_RCYLINDER)
-        amrex::ParticleReal zp = z_n[ip];
-        const amrex::ParticleReal zp_n = z_n[ip];
+            amrex::ParticleReal zp = z_n[ip];
+            const amrex::ParticleReal zp_n = z_n[ip];
 #else
-        amrex::ParticleReal zp = 0._prt;
-        const amrex::ParticleReal zp_n = 0._prt;
+            amrex::ParticleReal zp = 0._prt;
+            const amrex::ParticleReal zp_n = 0._prt;
 #endif
 
 #ifdef WARPX_QED
-        amrex::ParticleReal p_optical_depth_QSR0 = 0.0_prt;
-        if (p_optical_depth_QSR) {
-            p_optical_depth_QSR0 = p_optical_depth_QSR[ip];
-        }
+            amrex::ParticleReal p_optical_depth_QSR0 = 0.0_prt;
+            if (p_optical_depth_QSR) {
+                p_optical_depth_QSR0 = p_optical_depth_QSR[ip];
+            }
 #endif
 
-        amrex::ParticleReal Bxp = 0.0_prt;
-        amrex::ParticleReal Byp = 0.0_prt;
-        amrex::ParticleReal Bzp = 0.0_prt;
-        amrex::ParticleReal step_norm = 1._prt;
-
-        const bool convergence =
-            PushXPSingleStep<exteb_control, qed_control>(
-                ip, dt, setPosition, false,
-                xp, yp, zp, ux, uy, uz, xp_n, yp_n, zp_n, ux_n[ip], uy_n[ip], uz_n[ip],
-                step_norm, particle_tolerance, max_iterations,
-                Ex_external_particle, Ey_external_particle, Ez_external_particle,
-                Bx_external_particle, By_external_particle, Bz_external_particle,
-                Bxp, Byp, Bzp,
-                do_gather, ex_arr, ey_arr, ez_arr, bx_arr, by_arr, bz_arr,
-                ex_type, ey_type, ez_type, bx_type, by_type, bz_type,
-                dinv, xyzmin, domain_double, do_cropping, lo, n_rz_azimuthal_modes, depos_order, depos_type,
-                getExternalEB, ion_lev, mass, q, pusher_algo, do_crr
+            amrex::ParticleReal Bxp = 0.0_prt;
+            amrex::ParticleReal Byp = 0.0_prt;
+            amrex::ParticleReal Bzp = 0.0_prt;
+            amrex::ParticleReal step_norm = 1._prt;
+
+            const bool convergence =
+                PushXPSingleStep<exteb_control, qed_control>(
+                    ip, dt, setPosition, false,
+                    xp, yp, zp, ux, uy, uz, xp_n, yp_n, zp_n, ux_n[ip], uy_n[ip], uz_n[ip],
+                    step_norm, particle_tolerance, pass_max_iterations,
+                    Ex_external_particle, Ey_external_particle, Ez_external_particle,
+                    Bx_external_particle, By_external_particle, Bz_external_particle,
+                    Bxp, Byp, Bzp,
+                    do_gather, ex_arr, ey_arr, ez_arr, bx_arr, by_arr, bz_arr,
+                    ex_type, ey_type, ez_type, bx_type, by_type, bz_type,
+                    dinv, xyzmin, domain_double, do_cropping, lo, n_rz_azimuthal_modes, depos_order, depos_type,
+                    getExternalEB, ion_lev, mass, q, pusher_algo, do_crr
 #ifdef WARPX_QED
-                , do_sync, t_chi_max, p_optical_depth_QSR, evolve_opt
+                    , do_sync, t_chi_max, p_optical_depth_QSR, evolve_opt
 #endif
-            );
-
-        // check if particle did not converge
-        if (max_iterations > 1 && !convergence) {
+                );
 
-            if (nsuborbits) {
-                // Suborbits are required for this particle to converge.
-                // It will be handled later in a special loop with suborbiting.
-                nsuborbits[ip] = 2;
+            // After the fast pass, unconverged particles are queued for the second pass.
+            // They resume from the time-centered velocity of their last iteration.
+            if (fast_pass && !convergence) {
+#ifdef WARPX_QED
+                if (p_optical_depth_QSR) {
+                    p_optical_depth_QSR[ip] = p_optical_depth_QSR0;
+                }
+#endif
+                straggler_flag[ip] = 1;
+                amrex::Gpu::Atomic::Add(num_stragglers_ptr, amrex::Long(1));
+                return;
             }
 
+            // check if particle did not converge
+            if (max_iterations > 1 && !convergence) {
+
+                if (nsuborbits) {
+                    // Suborbits are required for this particle to converge.
+                    // It will be handled later in a special loop with suborbiting.
+                    nsuborbits[ip] = 2;
+                }
+
 #if !defined(AMREX_USE_GPU)
-            if (print_unconverged_particle_details) {
-                std::stringstream convergenceMsg;
-                convergenceMsg << "Picard solver for particle failed to converge after " <<
-                    max_iterations << " iterations.\n";
-                convergenceMsg << "Position step norm is " << step_norm <<
-                    " and the tolerance is " << particle_tolerance << "\n";
-                convergenceMsg << " ux = " << ux[ip] << ", uy = " << uy[ip] << ", uz = " << uz[ip] << "\n";
-                convergenceMsg << " xp = " << xp << ", yp = " << yp << ", zp = " << zp;
-                ablastr::warn_manager::WMRecordWarning("ImplicitPushXP", convergenceMsg.str());
-            }
+                if (print_unconverged_particle_details) {
+                    std::stringstream convergenceMsg;
+                    convergenceMsg << "Picard solver for particle failed to converge after " <<
+                        max_iterations << " iterations.\n";
+                    convergenceMsg << "Position step norm is " << step_norm <<
+                        " and the tolerance is " << particle_tolerance << "\n";
+                    convergenceMsg << " ux = " << ux[ip] << ", uy = " << uy[ip] << ", uz = " << uz[ip] << "\n";
+                    convergenceMsg << " xp = " << xp << ", yp = " << yp << ", zp = " << zp;
+                    ablastr::warn_manager::WMRecordWarning("ImplicitPushXP", convergenceMsg.str());
+                }
 #endif
 
 #ifdef WARPX_QED
-            // Reset the QED parameter to what is was at the start of the step
-            if (p_optical_depth_QSR) {
-                p_optical_depth_QSR[ip] = p_optical_depth_QSR0;
-            }
+                // Reset the QED parameter to what is was at the start of the step
+                if (p_optical_depth_QSR) {
+                    p_optical_depth_QSR[ip] = p_optical_depth_QSR0;
+                }
 #endif
 
-            // write signaling flag: how many particles did not converge?
-            amrex::Gpu::Atomic::Add(unconverged_particles_ptr, amrex::Long(1));
+                // write signaling flag: how many particles did not converge?
+                amrex::Gpu::Atomic::Add(unconverged_particles_ptr, amrex::Long(1));
+            }
+
+        });
+
+        if (fast_pass) {
+            // Gather the indices of the particles that need more iterations
+            const auto num_stragglers = static_cast<long>(*(num_stragglers_buffer.copyToHost()));
+            if (num_stragglers == 0) { break; }
+            straggler_indices.resize(num_stragglers);
+            long * const AMREX_RESTRICT straggler_i = straggler_indices.data();
+            amrex::Scan::PrefixSum<long>(np_to_push,
+                [=] AMREX_GPU_DEVICE (long ip) -> long { return straggler_flag[ip]; },
+                [=] AMREX_GPU_DEVICE (long ip, long x)
+                {
+                    if (straggler_flag[ip] && x < num_stragglers) { straggler_i[x] = ip; }
+                },
+                amrex::Scan::Type::exclusive, amrex::Scan::noRetSum);
         }
 
-    });
+    } // end of loop over passes
 
     // Setup for handling the unconverged particles. A list of their indices is
     // gathered, their weights saved, and their weight set to zero (so they
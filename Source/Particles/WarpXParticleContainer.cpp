@@ -344,6 +344,7 @@ WarpXParticleContainer::AddNParticles (int /*lev*/, long n,
         scrapeParticlesAtEB(
             *this,
             warpx.m_fields.get_mr_levels(FieldType::distance_to_eb, warpx.finestLevel()),
+            warpx.GetEBBoxTypes(),
             ParticleBoundaryProcess::Absorb());
         deleteInvalidParticles();
     }
@@ -10,6 +10,10 @@
 #include <AMReX_BoxArray.H>
 #include <AMReX_DistributionMapping.H>
 #include <AMReX_IntVect.H>
+#include <AMReX_MFIter.H>
+#include <AMReX_MultiFab.H>
+
+#include <cstdint>
 
 void init_MultiFabRegister (py::module & m)
 {
@@ -206,4 +210,39 @@ void init_MultiFabRegister (py::module & m)
              py::arg("level")
         )
     ;
+
+    m.def("multifab_data_layout",
+        [](amrex::MultiFab const& mf)
+        {
+            auto to_tuple = [] (amrex::IntVect const& iv) {
+                py::tuple t(AMREX_SPACEDIM);
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) { t[d] = iv[d]; }
+                return t;
+            };
+            // box index, FAB box (with its index type), number of components
+            // and data pointer of each local FAB
+            py::list layout;
+            for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+                auto const& fab = mf[mfi];
+                amrex::Box const& box = fab.box();
+                layout.append(py::make_tuple(
+                    mfi.index(),
+                    to_tuple(box.smallEnd()),
+                    to_tuple(box.bigEnd()),
+                    to_tuple(box.type()),
+                    fab.nComp(),
+                    reinterpret_cast<std::uintptr_t>(fab.dataPtr())
+                ));
+            }
+            return py::tuple(layout);
+        },
+        py::arg("mf"),
+        R"pbdoc(Local data layout of a MultiFab
+
+Returns a tuple with, for each FAB of this process, its box index, the lower
+and upper corners and index type of its box, its number of components and the
+address of its data. This changes whenever the FABs of this process are
+reallocated (e.g., after regrid or load balancing). It is used to invalidate
+cached zero-copy views of the field data.)pbdoc"
+    );
 }
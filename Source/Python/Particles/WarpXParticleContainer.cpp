@@ -8,6 +8,8 @@
 
 #include <Particles/WarpXParticleContainer.H>
 
+#include <cstdint>
+
 
 void init_WarpXParIter (py::module& m)
 {
@@ -97,6 +99,51 @@ void init_WarpXParticleContainer (py::module& m)
             },
             py::arg("comp_name")
         )
+        .def("data_layout",
+            [](WarpXParticleContainer& pc, int lev)
+            {
+                auto data_address = [] (auto const& vec) {
+                    return reinterpret_cast<std::uintptr_t>(vec.dataPtr());
+                };
+                // grid and tile indices, number of particles and data
+                // pointers of all components of each local tile
+                py::list layout;
+                for (auto const& [index, ptile] : pc.GetParticles(lev)) {
+                    auto const& soa = ptile.GetStructOfArrays();
+                    py::tuple real_data(soa.NumRealComps());
+                    for (int i = 0; i < soa.NumRealComps(); ++i) {
+                        real_data[i] = data_address(soa.GetRealData(i));
+                    }
+                    py::tuple int_data(soa.NumIntComps());
+                    for (int i = 0; i < soa.NumIntComps(); ++i) {
+                        int_data[i] = data_address(soa.GetIntData(i));
+                    }
+                    layout.append(py::make_tuple(
+                        index.first,
+                        index.second,
+                        ptile.numParticles(),
+                        data_address(soa.GetIdCPUData()),
+                        real_data,
+                        int_data
+                    ));
+                }
+                return py::tuple(layout);
+            },
+            py::arg("lev"),
+            R"pbdoc(Local particle data layout on a level
+
+Returns a tuple with, for each particle tile of this process, its grid and
+tile indices, its number of particles and the addresses of the data of all
+its components. This changes whenever the particle arrays of this process
+are reallocated, resized, added or removed (e.g., after Redistribute, regrid,
+load balancing, injection or the addition of a runtime component). It is used
+to invalidate cached zero-copy views of the particle data.
+
+Parameters
+----------
+lev: int
+  Mesh refinement level)pbdoc"
+        )
         .def("sum_particle_weight",
             &WarpXParticleContainer::sumParticleWeight,
             py::arg("local")
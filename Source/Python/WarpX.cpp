@@ -264,14 +264,14 @@ void init_WarpX (py::module& m)
         // Add some accessor bindings for the Hybrid Ohm's Law Solver
         .def("set_hybrid_pic_substeps",
             [](WarpX& wx, int substeps) {
-                wx.get_pointer_HybridPICModel()->m_substeps = substeps;
+                wx.get_pointer_HybridPICModel()->SetSubsteps(substeps);
             },
             py::arg("substeps"),
             "Sets the number of substeps to take in the hybrid solver."
         )
         .def("get_hybrid_pic_substeps",
             [](WarpX& wx) {
-                return wx.get_pointer_HybridPICModel()->m_substeps;
+                return wx.get_pointer_HybridPICModel()->GetSubsteps(0);
             },
             "Gets the number of substeps taken in the hybrid solver."
         )
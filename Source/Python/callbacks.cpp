@@ -8,12 +8,19 @@
  */
 #include "callbacks.H"
 
+#include "WarpX.H"
+
+#include <AMReX_Utility.H>
+
+#include <algorithm>
 #include <cstdlib>
 #include <exception>
 #include <iostream>
 
 
 std::map< std::string, std::function<void()> > warpx_callback_py_map;
+std::map< std::string, PythonCallbackStats > warpx_callback_py_stats;
+std::map< std::string, ablastr::utils::text::IntervalsParser > warpx_callback_py_intervals;
 
 void InstallPythonCallback ( const std::string& name, std::function<void()> callback )
 {
@@ -29,7 +36,18 @@ bool IsPythonCallbackInstalled ( const std::string& name )
 void ExecutePythonCallback ( const std::string& name )
 {
     if ( IsPythonCallbackInstalled(name) ) {
+        auto& stats = warpx_callback_py_stats[name];
+
+        // skip the call without entering Python if the step is not in the intervals
+        auto const intervals = warpx_callback_py_intervals.find(name);
+        if ( intervals != warpx_callback_py_intervals.end() &&
+             !intervals->second.contains(WarpX::GetInstance().getistep(0)) ) {
+            ++stats.nskipped;
+            return;
+        }
+
         ABLASTR_PROFILE("warpx_py_" + name);
+        double const t_start = amrex::second();
         try {
             warpx_callback_py_map[name]();
         } catch (std::exception &e) {
@@ -44,6 +62,10 @@ void ExecutePythonCallback ( const std::string& name )
             // (and Python will be in continued error state).
             // https://pybind11.readthedocs.io/en/stable/advanced/exceptions.html#handling-unraisable-exceptions
         }
+        double const t_call = amrex::second() - t_start;
+        ++stats.ncalls;
+        stats.total_time += t_call;
+        stats.max_time = std::max(stats.max_time, t_call);
     }
 }
 
@@ -51,3 +73,18 @@ void ClearPythonCallback ( const std::string& name )
 {
     warpx_callback_py_map.erase(name);
 }
+
+void SetPythonCallbackIntervals ( const std::string& name, const std::string& intervals )
+{
+    if ( intervals.empty() ) {
+        warpx_callback_py_intervals.erase(name);
+    } else {
+        warpx_callback_py_intervals[name] = ablastr::utils::text::IntervalsParser({intervals});
+    }
+}
+
+PythonCallbackStats GetPythonCallbackStats ( const std::string& name )
+{
+    auto const stats = warpx_callback_py_stats.find(name);
+    return (stats != warpx_callback_py_stats.end()) ? stats->second : PythonCallbackStats{};
+}
@@ -135,4 +135,19 @@ PYBIND11_MODULE(PYWARPX_MODULE_NAME, m) {
     m.def("add_python_callback", &InstallPythonCallback);
     m.def("remove_python_callback", &ClearPythonCallback);
     m.def("execute_python_callback", &ExecutePythonCallback, py::arg("name"));
+    m.def("set_python_callback_intervals", &SetPythonCallbackIntervals,
+        py::arg("name"), py::arg("intervals"),
+        "Only execute the callback at the steps matching the intervals (empty string: every call)");
+    m.def("get_python_callback_stats",
+        [](std::string const& name) {
+            auto const stats = GetPythonCallbackStats(name);
+            py::dict d;
+            d["ncalls"] = stats.ncalls;
+            d["nskipped"] = stats.nskipped;
+            d["total_time"] = stats.total_time;
+            d["max_time"] = stats.max_time;
+            return d;
+        },
+        py::arg("name"),
+        "Timing statistics of the callback on this process");
 }
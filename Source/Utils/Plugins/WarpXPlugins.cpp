@@ -0,0 +1,135 @@
+/* Copyright 2026 The WarpX Community
+ *
+ * This file is part of WarpX.
+ *
+ * License: BSD-3-Clause-LBNL
+ */
+#include "WarpXPlugins.H"
+
+#include "Particles/MultiParticleContainer.H"
+#include "Utils/TextMsg.H"
+
+#include <ablastr/profiler/ProfilerWrapper.H>
+
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+
+#if !defined(_WIN32)
+#   include <dlfcn.h>
+#endif
+
+#include <utility>
+
+namespace warpx::plugins
+{
+    void
+    PluginRegistry::addParticleHook (std::string const& name, ParticleHook hook)
+    {
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_particle_hooks.contains(name),
+            "Plugin particle hook '" + name + "' is already registered");
+        m_particle_hooks[name] = std::move(hook);
+    }
+
+    void
+    PluginRegistry::addFieldHook (std::string const& name, FieldHook hook)
+    {
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_field_hooks.contains(name),
+            "Plugin field hook '" + name + "' is already registered");
+        m_field_hooks[name] = std::move(hook);
+    }
+
+    void
+    PluginRegistry::addReducedDiag (std::string const& name,
+                                    std::vector<std::string> column_names,
+                                    ReducedDiagHook compute)
+    {
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!m_reduced_diags.contains(name),
+            "Plugin reduced diagnostic '" + name + "' is already registered");
+        m_reduced_diags[name] = ReducedDiagPlugin{std::move(column_names), std::move(compute)};
+    }
+
+    ReducedDiagPlugin const&
+    PluginRegistry::getReducedDiag (std::string const& name) const
+    {
+        auto const rd = m_reduced_diags.find(name);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(rd != m_reduced_diags.end(),
+            "No plugin registered the reduced diagnostic '" + name + "' (see warpx.plugins)");
+        return rd->second;
+    }
+
+    void
+    PluginRegistry::executeParticleHooks (MultiParticleContainer& mypc, int finest_level,
+                                          amrex::Real time, amrex::Real dt) const
+    {
+        for (auto const& [name, hook] : m_particle_hooks) {
+            ABLASTR_PROFILE("warpx_plugin_" + name);
+            for (int i = 0; i < mypc.nContainers(); ++i) {
+                auto& pc = mypc.GetParticleContainer(i);
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    hook(pc, lev, time, dt);
+                }
+            }
+        }
+    }
+
+    void
+    PluginRegistry::executeFieldHooks (ablastr::fields::MultiFabRegister& fields, int finest_level,
+                                       amrex::Real time, amrex::Real dt) const
+    {
+        for (auto const& [name, hook] : m_field_hooks) {
+            ABLASTR_PROFILE("warpx_plugin_" + name);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                hook(fields, lev, time, dt);
+            }
+        }
+    }
+
+    void
+    PluginRegistry::load (std::string const& path)
+    {
+        if (m_loaded_libraries.contains(path)) { return; }
+
+#if defined(_WIN32)
+        WARPX_ABORT_WITH_MESSAGE("warpx.plugins is not supported on Windows");
+#else
+        // RTLD_GLOBAL: let the plugin share the AMReX and WarpX symbols already loaded
+        void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+        if (handle == nullptr) {
+            char const* err = dlerror();
+            WARPX_ABORT_WITH_MESSAGE("Could not load the plugin " + path + ": " +
+                std::string(err ? err : "unknown error"));
+        }
+
+        using RegisterFunction = void (*)(PluginRegistry&);
+        auto* const register_plugin = reinterpret_cast<RegisterFunction>(
+            dlsym(handle, register_function_name));
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(register_plugin != nullptr,
+            "The plugin " + path + " does not define the function " +
+            std::string(register_function_name));
+
+        // the library is intentionally never closed, since the hooks refer to its code
+        register_plugin(*this);
+        m_loaded_libraries.insert(path);
+
+        amrex::Print() << Utils::TextMsg::Info("Loaded the plugin " + path);
+#endif
+    }
+
+    PluginRegistry&
+    GetPluginRegistry ()
+    {
+        static PluginRegistry registry;
+        return registry;
+    }
+
+    void
+    LoadPlugins ()
+    {
+        const amrex::ParmParse pp_warpx("warpx");
+        std::vector<std::string> plugin_paths;
+        pp_warpx.queryarr("plugins", plugin_paths);
+        for (auto const& path : plugin_paths) {
+            GetPluginRegistry().load(path);
+        }
+    }
+}
@@ -68,6 +68,7 @@ namespace
     * \param[in] dir direction of the shift
     * \param[in] safe_guard_cells flag to enable "safe mode" data exchanges with more guard cells
     * \param[in] do_single_precision_comms flag to enable single precision communications
+    * \param[in] in_place flag to shift the data within the existing storage of mf, without a temporary copy
     * \param[in,out] cost the pointer to the data structure holding costs for timer-based load-balance
     * \param[in] external_field the external field (used to initialize EM fields)
     * \param[in] useparser flag to enable the use of a field parser to initialize EM fields
@@ -77,7 +78,7 @@ namespace
     void shiftMF (
         amrex::MultiFab& mf, const amrex::Geometry& geom,
         int num_shift, int dir,
-        bool safe_guard_cells, bool do_single_precision_comms,
+        bool safe_guard_cells, bool do_single_precision_comms, bool in_place,
         amrex::LayoutData<amrex::Real>* cost,
         amrex::Real external_field=0.0, bool useparser = false,
         amrex::ParserExecutor<3> const& field_parser={},
@@ -92,12 +93,19 @@ namespace
 
         AMREX_ALWAYS_ASSERT(ng[dir] >= std::abs(num_shift));
 
-        // The temporary copy is required for correctness (not just convenience):
+        // By default, the temporary copy is required for correctness (not just convenience):
         // the shifted copy below reads from tmpmf while writing to mf, both under
         // AMREX_PARALLEL_FOR_4D whose CPU SIMD pragma asserts iteration
-        // independence. An in-place shift of mf would violate that (see issue #7097).
-        amrex::MultiFab tmpmf(ba, dm, nc, ng);
-        amrex::MultiFab::Copy(tmpmf, mf, 0, 0, nc, ng);
+        // independence. A naive in-place shift of mf would violate that (see issue #7097).
+        // With in_place, tmpmf is only an alias of mf and the shift is done by a kernel
+        // where each work item owns a full line of cells along dir (see below), which
+        // avoids allocating and copying a full MultiFab at each move of the window.
+        amrex::MultiFab tmpmf = in_place ?
+            amrex::MultiFab(mf, amrex::make_alias, 0, nc) :
+            amrex::MultiFab(ba, dm, nc, ng);
+        if (!in_place) {
+            amrex::MultiFab::Copy(tmpmf, mf, 0, 0, nc, ng);
+        }
 
         if ( safe_guard_cells ) {
             // Fill guard cells.
@@ -146,7 +154,9 @@ namespace
 #ifdef AMREX_USE_OMP
     #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-        for (amrex::MFIter mfi(tmpmf, TilingIfNotGPU()); mfi.isValid(); ++mfi )
+        // The in-place shift works on full boxes: tiles of the same box would
+        // read and write overlapping lines of cells.
+        for (amrex::MFIter mfi(tmpmf, !in_place && TilingIfNotGPU()); mfi.isValid(); ++mfi )
         {
             if (cost)
             {
@@ -213,10 +223,37 @@ namespace
             } else {
                 dstBox.growLo(dir,  num_shift);
             }
-            AMREX_PARALLEL_FOR_4D ( dstBox, nc, i, j, k, n,
-            {
-                dstfab(i,j,k,n) = srcfab(i+shift.x,j+shift.y,k+shift.z,n);
-            })
+            if (in_place) {
+                // Each work item shifts one line of cells along dir, starting from the end
+                // that is overwritten first: a source cell is always read before it is
+                // written, and distinct work items never touch the same cells.
+                const int nline = dstBox.length(dir);
+                amrex::Box slab = dstBox;
+                amrex::IntVect stepiv(0);
+                if (num_shift > 0) {
+                    slab.setBig(dir, dstBox.smallEnd(dir));
+                    stepiv[dir] = 1;
+                } else {
+                    slab.setSmall(dir, dstBox.bigEnd(dir));
+                    stepiv[dir] = -1;
+                }
+                const amrex::Dim3 step = stepiv.dim3();
+                amrex::ParallelFor(slab, nc,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+                {
+                    for (int m = 0; m < nline; ++m) {
+                        const int ii = i + m*step.x;
+                        const int jj = j + m*step.y;
+                        const int kk = k + m*step.z;
+                        dstfab(ii,jj,kk,n) = dstfab(ii+shift.x,jj+shift.y,kk+shift.z,n);
+                    }
+                });
+            } else {
+                AMREX_PARALLEL_FOR_4D ( dstBox, nc, i, j, k, n,
+                {
+                    dstfab(i,j,k,n) = srcfab(i+shift.x,j+shift.y,k+shift.z,n);
+                })
+            }
 
             if (cost)
             {
@@ -465,60 +502,60 @@ WarpX::MoveWindow (const int step, bool move_j)
                 if (dim == 1) { Efield_parser = m_p_ext_field_params->Eyfield_parser->compile<3>(); }
                 if (dim == 2) { Efield_parser = m_p_ext_field_params->Ezfield_parser->compile<3>(); }
             }
-            ::shiftMF(*m_fields.get(FieldType::Bfield_fp, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+            ::shiftMF(*m_fields.get(FieldType::Bfield_fp, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                 m_p_ext_field_params->B_external_grid[dim], use_Bparser, Bfield_parser);
-            ::shiftMF(*m_fields.get(FieldType::Efield_fp, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+            ::shiftMF(*m_fields.get(FieldType::Efield_fp, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                 m_p_ext_field_params->E_external_grid[dim], use_Eparser, Efield_parser);
             if (fft_do_time_averaging) {
                 ablastr::fields::MultiLevelVectorField Efield_avg_fp = m_fields.get_mr_levels_alldirs(FieldType::Efield_avg_fp, finest_level);
                 ablastr::fields::MultiLevelVectorField Bfield_avg_fp = m_fields.get_mr_levels_alldirs(FieldType::Bfield_avg_fp, finest_level);
-                ::shiftMF(*Bfield_avg_fp[lev][dim], geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+                ::shiftMF(*Bfield_avg_fp[lev][dim], geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                     m_p_ext_field_params->B_external_grid[dim], use_Bparser, Bfield_parser);
-                ::shiftMF(*Efield_avg_fp[lev][dim], geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+                ::shiftMF(*Efield_avg_fp[lev][dim], geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                    m_p_ext_field_params-> E_external_grid[dim], use_Eparser, Efield_parser);
             }
             if (move_j) {
-                ::shiftMF(*m_fields.get(FieldType::current_fp, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+                ::shiftMF(*m_fields.get(FieldType::current_fp, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
             }
             if (pml[lev] && pml[lev]->ok()) {
                 amrex::MultiFab* pml_B = m_fields.get(FieldType::pml_B_fp, Direction{dim}, lev);
                 amrex::MultiFab* pml_E = m_fields.get(FieldType::pml_E_fp, Direction{dim}, lev);
-                ::shiftMF(*pml_B, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
-                ::shiftMF(*pml_E, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
+                ::shiftMF(*pml_B, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
+                ::shiftMF(*pml_E, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
             }
 #if (defined WARPX_DIM_RZ) && (defined WARPX_USE_FFT)
             const bool PMLRZ_flag = pml_rz[0].get();
             if (pml_rz[lev] && dim < 2) {
                 amrex::MultiFab* pml_rz_B = m_fields.get(FieldType::pml_B_fp, Direction{dim}, lev);
                 amrex::MultiFab* pml_rz_E = m_fields.get(FieldType::pml_E_fp, Direction{dim}, lev);
-                ::shiftMF(*pml_rz_B, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, no_cost, 0.0_rt, false, amrex::ParserExecutor<3>{}, PMLRZ_flag);
-                ::shiftMF(*pml_rz_E, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, no_cost, 0.0_rt, false, amrex::ParserExecutor<3>{}, PMLRZ_flag);
+                ::shiftMF(*pml_rz_B, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost, 0.0_rt, false, amrex::ParserExecutor<3>{}, PMLRZ_flag);
+                ::shiftMF(*pml_rz_E, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost, 0.0_rt, false, amrex::ParserExecutor<3>{}, PMLRZ_flag);
             }
 #endif
             if (lev > 0) {
                 // coarse grid
-                ::shiftMF(*m_fields.get(FieldType::Bfield_cp, Direction{dim}, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+                ::shiftMF(*m_fields.get(FieldType::Bfield_cp, Direction{dim}, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                     m_p_ext_field_params->B_external_grid[dim], use_Bparser, Bfield_parser);
-                ::shiftMF(*m_fields.get(FieldType::Efield_cp, Direction{dim}, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+                ::shiftMF(*m_fields.get(FieldType::Efield_cp, Direction{dim}, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                     m_p_ext_field_params->E_external_grid[dim], use_Eparser, Efield_parser);
-                ::shiftMF(*m_fields.get(FieldType::Bfield_aux, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
-                ::shiftMF(*m_fields.get(FieldType::Efield_aux, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+                ::shiftMF(*m_fields.get(FieldType::Bfield_aux, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
+                ::shiftMF(*m_fields.get(FieldType::Efield_aux, Direction{dim}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
                 if (fft_do_time_averaging) {
                     ablastr::fields::MultiLevelVectorField Efield_avg_cp = m_fields.get_mr_levels_alldirs(FieldType::Efield_avg_cp, finest_level, skip_lev0_coarse_patch);
                     ablastr::fields::MultiLevelVectorField Bfield_avg_cp = m_fields.get_mr_levels_alldirs(FieldType::Bfield_avg_cp, finest_level, skip_lev0_coarse_patch);
-                    ::shiftMF(*Bfield_avg_cp[lev][dim], geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+                    ::shiftMF(*Bfield_avg_cp[lev][dim], geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                         m_p_ext_field_params->B_external_grid[dim], use_Bparser, Bfield_parser);
-                    ::shiftMF(*Efield_avg_cp[lev][dim], geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev,
+                    ::shiftMF(*Efield_avg_cp[lev][dim], geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev,
                         m_p_ext_field_params->E_external_grid[dim], use_Eparser, Efield_parser);
                 }
                 if (move_j) {
-                    ::shiftMF(*m_fields.get(FieldType::current_cp, Direction{dim}, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+                    ::shiftMF(*m_fields.get(FieldType::current_cp, Direction{dim}, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
                 }
                 if (do_pml && pml[lev]->ok()) {
                     amrex::MultiFab* pml_B_cp = m_fields.get(FieldType::pml_B_cp, Direction{dim}, lev);
                     amrex::MultiFab* pml_E_cp = m_fields.get(FieldType::pml_E_cp, Direction{dim}, lev);
-                    ::shiftMF(*pml_B_cp, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
-                    ::shiftMF(*pml_E_cp, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
+                    ::shiftMF(*pml_B_cp, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
+                    ::shiftMF(*pml_E_cp, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
                 }
             }
         }
@@ -528,11 +565,11 @@ WarpX::MoveWindow (const int step, bool move_j)
         if (m_fields.has(FieldType::F_fp, lev))
         {
             // Fine grid
-            ::shiftMF(*m_fields.get(FieldType::F_fp, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+            ::shiftMF(*m_fields.get(FieldType::F_fp, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
             if (lev > 0)
             {
                 // Coarse grid
-                ::shiftMF(*m_fields.get(FieldType::F_cp, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+                ::shiftMF(*m_fields.get(FieldType::F_cp, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
             }
         }
 
@@ -543,7 +580,7 @@ WarpX::MoveWindow (const int step, bool move_j)
             if (do_pml && pml[lev]->ok())
             {
                 amrex::MultiFab* pml_F = m_fields.get(FieldType::pml_F_fp, lev);
-                ::shiftMF(*pml_F, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
+                ::shiftMF(*pml_F, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
             }
             if (lev > 0)
             {
@@ -551,7 +588,7 @@ WarpX::MoveWindow (const int step, bool move_j)
                 if (do_pml && pml[lev]->ok())
                 {
                     amrex::MultiFab* pml_F = m_fields.get(FieldType::pml_F_cp, lev);
-                    ::shiftMF(*pml_F, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
+                    ::shiftMF(*pml_F, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
                 }
             }
         }
@@ -561,11 +598,11 @@ WarpX::MoveWindow (const int step, bool move_j)
         if (m_fields.has(FieldType::G_fp, lev))
         {
             // Fine grid
-            ::shiftMF(*m_fields.get(FieldType::G_fp, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+            ::shiftMF(*m_fields.get(FieldType::G_fp, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
             if (lev > 0)
             {
                 // Coarse grid
-                ::shiftMF(*m_fields.get(FieldType::G_cp, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+                ::shiftMF(*m_fields.get(FieldType::G_cp, lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
             }
         }
 
@@ -576,7 +613,7 @@ WarpX::MoveWindow (const int step, bool move_j)
             if (do_pml && pml[lev]->ok())
             {
                 amrex::MultiFab* pml_G = m_fields.get(FieldType::pml_G_fp, lev);
-                ::shiftMF(*pml_G, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
+                ::shiftMF(*pml_G, geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
             }
             if (lev > 0)
             {
@@ -584,7 +621,7 @@ WarpX::MoveWindow (const int step, bool move_j)
                 if (do_pml && pml[lev]->ok())
                 {
                     amrex::MultiFab* pml_G = m_fields.get(FieldType::pml_G_cp, lev);
-                    ::shiftMF(*pml_G, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, no_cost);
+                    ::shiftMF(*pml_G, geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, no_cost);
                 }
             }
         }
@@ -593,10 +630,10 @@ WarpX::MoveWindow (const int step, bool move_j)
         if (move_j) {
             if (m_fields.has(FieldType::rho_fp, lev)) {
                 // Fine grid
-                ::shiftMF(*m_fields.get(FieldType::rho_fp,lev),   geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+                ::shiftMF(*m_fields.get(FieldType::rho_fp,lev),   geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
                 if (lev > 0){
                     // Coarse grid
-                    ::shiftMF(*m_fields.get(FieldType::rho_cp,lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev);
+                    ::shiftMF(*m_fields.get(FieldType::rho_cp,lev), geom[lev-1], num_shift_crse, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev);
                 }
             }
         }
@@ -606,10 +643,10 @@ WarpX::MoveWindow (const int step, bool move_j)
             const int n_fluid_species = myfl->nSpecies();
             for (int i=0; i<n_fluid_species; i++) {
                 WarpXFluidContainer const& fl = myfl->GetFluidContainer(i);
-                ::shiftMF( *m_fields.get(fl.name_mf_N, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev );
-                ::shiftMF( *m_fields.get(fl.name_mf_NU, Direction{0}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev );
-                ::shiftMF( *m_fields.get(fl.name_mf_NU, Direction{1}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev );
-                ::shiftMF( *m_fields.get(fl.name_mf_NU, Direction{2}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, cost_lev );
+                ::shiftMF( *m_fields.get(fl.name_mf_N, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev );
+                ::shiftMF( *m_fields.get(fl.name_mf_NU, Direction{0}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev );
+                ::shiftMF( *m_fields.get(fl.name_mf_NU, Direction{1}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev );
+                ::shiftMF( *m_fields.get(fl.name_mf_NU, Direction{2}, lev), geom[lev], num_shift, dir, m_safe_guard_cells, do_single_precision_comms, m_moving_window_in_place_shift, cost_lev );
             }
         }
     }
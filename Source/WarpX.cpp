@@ -26,6 +26,7 @@
 #include "FieldSolver/FiniteDifferenceSolver/MacroscopicProperties/MacroscopicProperties.H"
 #include "FieldSolver/FiniteDifferenceSolver/HybridPICModel/HybridPICModel.H"
 #ifdef WARPX_USE_FFT
+#   include "Filter/KSpaceBinomialFilter.H"
 #   include "FieldSolver/SpectralSolver/SpectralKSpace.H"
 #   ifdef WARPX_DIM_RZ
 #       include "FieldSolver/SpectralSolver/SpectralSolverRZ.H"
@@ -44,6 +45,7 @@
 #include "Fluids/WarpXFluidContainer.H"
 #include "Particles/ParticleBoundaryBuffer.H"
 #include "AcceleratorLattice/AcceleratorLattice.H"
+#include "Utils/Plugins/WarpXPlugins.H"
 #include "Utils/TextMsg.H"
 #include "Utils/WarpXAlgorithmSelection.H"
 #include "Utils/WarpXConst.H"
@@ -157,6 +159,8 @@ bool WarpX::galerkin_interpolation = true;
 bool WarpX::use_filter = true;
 bool WarpX::use_kspace_filter       = true;
 bool WarpX::use_filter_compensation = false;
+bool WarpX::use_separable_filter = false;
+bool WarpX::filter_current_in_kspace = false;
 
 bool WarpX::serialize_initial_conditions = false;
 bool WarpX::refine_plasma     = false;
@@ -346,6 +350,8 @@ WarpX::WarpX ()
 
     ablastr::utils::SignalHandling::InitSignalHandling();
 
+    warpx::plugins::LoadPlugins();
+
     // Geometry on all levels has been defined already.
     // No valid BoxArray and DistributionMapping have been defined.
     // But the arrays for them have been resized.
@@ -400,6 +406,7 @@ WarpX::WarpX ()
 
     m_eb_update_E.resize(nlevs_max);
     m_eb_update_B.resize(nlevs_max);
+    m_eb_no_update_E_box.resize(nlevs_max);
     m_eb_reduce_particle_shape.resize(nlevs_max);
 
     m_flag_info_face.resize(nlevs_max);
@@ -695,6 +702,7 @@ WarpX::ReadParameters ()
         pp_warpx.query("do_subcycling", m_do_subcycling);
         pp_warpx.query("use_hybrid_QED", use_hybrid_QED);
         pp_warpx.query("safe_guard_cells", m_safe_guard_cells);
+        pp_warpx.query("moving_window_in_place_shift", m_moving_window_in_place_shift);
         std::vector<std::string> override_sync_intervals_string_vec = {"1"};
         pp_warpx.queryarr("override_sync_intervals", override_sync_intervals_string_vec);
         override_sync_intervals =
@@ -804,6 +812,13 @@ WarpX::ReadParameters ()
         utils::parser::queryWithParser(pp_warpx, "magnetostatic_solver_max_iters", magnetostatic_solver_max_iters);
         utils::parser::queryWithParser(pp_warpx, "self_fields_verbosity", magnetostatic_solver_verbosity);
         utils::parser::queryWithParser(pp_warpx, "magnetostatic_solver_verbosity", magnetostatic_solver_verbosity);
+        utils::parser::queryWithParser(pp_warpx, "self_fields_reuse_solver", magnetostatic_solver_reuse_solver);
+        utils::parser::queryWithParser(pp_warpx, "magnetostatic_solver_reuse_solver", magnetostatic_solver_reuse_solver);
+        utils::parser::queryWithParser(pp_warpx, "magnetostatic_solver_skip_tolerance", magnetostatic_solver_skip_tolerance);
+        utils::parser::queryWithParser(pp_warpx, "magnetostatic_solver_max_skipped_solves", magnetostatic_solver_max_skipped_solves);
+        WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+            magnetostatic_solver_skip_tolerance >= 0._rt,
+            "warpx.magnetostatic_solver_skip_tolerance must be non-negative");
 
         WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
         (
@@ -870,6 +885,8 @@ WarpX::ReadParameters ()
         // proper size for AMREX_SPACEDIM
         pp_warpx.query("use_filter", use_filter);
         pp_warpx.query("use_filter_compensation", use_filter_compensation);
+        pp_warpx.query("use_separable_filter", use_separable_filter);
+        pp_warpx.query("filter_current_in_kspace", filter_current_in_kspace);
         Vector<int> parse_filter_npass_each_dir(AMREX_SPACEDIM,1);
         utils::parser::queryArrWithParser(
             pp_warpx, "filter_npass_each_dir", parse_filter_npass_each_dir, 0, AMREX_SPACEDIM);
@@ -900,6 +917,47 @@ WarpX::ReadParameters ()
         }
 #endif
 
+        if (filter_current_in_kspace) {
+#if !defined(WARPX_USE_FFT) || defined(WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
+            WARPX_ABORT_WITH_MESSAGE(
+                "warpx.filter_current_in_kspace requires WarpX to be compiled with FFT support, in Cartesian geometry");
+#endif
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(use_filter,
+                "warpx.filter_current_in_kspace = 1 requires warpx.use_filter = 1");
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(maxLevel() == 0,
+                "warpx.filter_current_in_kspace is only supported without mesh refinement");
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                    field_boundary_lo[idim] == FieldBoundaryType::Periodic &&
+                    field_boundary_hi[idim] == FieldBoundaryType::Periodic,
+                    "warpx.filter_current_in_kspace requires periodic field boundaries in all directions");
+            }
+        }
+
+        pp_warpx.query("freeze_empty_boxes", m_freeze_empty_boxes);
+        if (m_freeze_empty_boxes) {
+            utils::parser::queryWithParser(
+                pp_warpx, "freeze_empty_boxes_interval", m_freeze_empty_boxes_interval);
+            utils::parser::queryWithParser(
+                pp_warpx, "freeze_empty_boxes_threshold", m_freeze_empty_boxes_threshold);
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_freeze_empty_boxes_interval > 0,
+                "warpx.freeze_empty_boxes_interval must be positive");
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(m_freeze_empty_boxes_threshold >= 0,
+                "warpx.freeze_empty_boxes_threshold must be non-negative");
+#if defined(WARPX_DIM_RZ) || defined(WARPX_DIM_RCYLINDER) || defined(WARPX_DIM_RSPHERE)
+            WARPX_ABORT_WITH_MESSAGE("warpx.freeze_empty_boxes is only supported in Cartesian geometry");
+#endif
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(
+                evolve_scheme == EvolveScheme::Explicit &&
+                (electromagnetic_solver_id == ElectromagneticSolverAlgo::Yee ||
+                 electromagnetic_solver_id == ElectromagneticSolverAlgo::CKC),
+                "warpx.freeze_empty_boxes requires the explicit Yee or CKC solver");
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(maxLevel() == 0 && do_moving_window == 0,
+                "warpx.freeze_empty_boxes is not supported with mesh refinement or the moving window");
+            WARPX_ALWAYS_ASSERT_WITH_MESSAGE(!filter_current_in_kspace,
+                "warpx.freeze_empty_boxes is not compatible with warpx.filter_current_in_kspace");
+        }
+
         utils::parser::queryWithParser(
             pp_warpx, "num_mirrors", m_num_mirrors);
         if (m_num_mirrors>0){
@@ -1441,6 +1499,7 @@ WarpX::ReadParameters ()
                 pp_algo, "costs_heuristic_cells_wt", costs_heuristic_cells_wt);
             utils::parser::queryWithParser(
                 pp_algo, "costs_heuristic_particles_wt", costs_heuristic_particles_wt);
+            pp_algo.query("costs_heuristic_eb_weighting", costs_heuristic_eb_weighting);
         }
 
         // Parse algo.particle_shape and check that input is acceptable
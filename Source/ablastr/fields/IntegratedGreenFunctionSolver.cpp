@@ -28,8 +28,45 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_REAL.H>
 
+#include <algorithm>
+#include <array>
+#include <list>
+#include <memory>
+
 namespace ablastr::fields {
 
+namespace {
+
+    /** An FFT open-boundary solver with its transformed Green's function
+     *
+     * The Green's function only depends on the shape of the domain, the
+     * cell size and whether 2D slices are used, so the solver can be reused
+     * for every solve with the same key.
+     */
+    struct IGFSolverCacheEntry
+    {
+        amrex::Box domain;
+        std::array<amrex::Real, 3> cell_size;
+        bool is_igf_2d_slices;
+        int nprocs;
+        std::unique_ptr<amrex::FFT::OpenBCSolver<amrex::Real>> solver;
+
+        [[nodiscard]] bool
+        matches (amrex::Box const& a_domain,
+                 std::array<amrex::Real, 3> const& a_cell_size,
+                 bool a_is_igf_2d_slices,
+                 int a_nprocs) const
+        {
+            return domain == a_domain && cell_size == a_cell_size &&
+                   is_igf_2d_slices == a_is_igf_2d_slices && nprocs == a_nprocs;
+        }
+    };
+
+    /** Solvers of the most recent keys, most recently used first */
+    std::list<IGFSolverCacheEntry> igf_solver_cache;
+
+} // namespace
+
 void
 computePhiIGF ( amrex::MultiFab const & rho,
                 amrex::MultiFab & phi,
@@ -53,53 +90,83 @@ computePhiIGF ( amrex::MultiFab const & rho,
         nprocs = std::max(1,std::min(nprocs, amrex::ParallelDescriptor::NProcs()));
     }
 
-    static std::unique_ptr<amrex::FFT::OpenBCSolver<amrex::Real>> obc_solver;
-    if (!obc_solver) {
-        amrex::ExecOnFinalize([&] () { obc_solver.reset(); });
+    // Number of (domain, cell size, mode) keys for which the solver and the
+    // transformed Green's function are kept in memory, e.g., for several
+    // species with the relativistic solver or several levels
+    static int const cache_size = [] () {
+        int n = 1;
+        amrex::ParmParse const pp("ablastr");
+        pp.query("igf_solver_cache_size", n);
+        return std::max(1, n);
+    }();
+
+    static bool cache_cleanup_registered = false;
+    if (!cache_cleanup_registered) {
+        amrex::ExecOnFinalize([] () { igf_solver_cache.clear(); });
+        cache_cleanup_registered = true;
     }
-    if (!obc_solver || obc_solver->Domain() != domain) {
+
+    auto entry = std::find_if(igf_solver_cache.begin(), igf_solver_cache.end(),
+        [&] (IGFSolverCacheEntry const& e) {
+            return e.matches(domain, cell_size, is_igf_2d_slices, nprocs);
+        });
+
+    if (entry != igf_solver_cache.end()) {
+        // move the entry to the front of the list (most recently used)
+        igf_solver_cache.splice(igf_solver_cache.begin(), igf_solver_cache, entry);
+    } else {
+        // evict the least recently used solvers
+        while (static_cast<int>(igf_solver_cache.size()) >= cache_size) {
+            igf_solver_cache.pop_back();
+        }
+
         amrex::FFT::Info info{};
         if (is_igf_2d_slices) { info.setTwoDMode(true); } // do 2D FFTs
         info.setNumProcs(nprocs);
-        obc_solver = std::make_unique<amrex::FFT::OpenBCSolver<amrex::Real>>(domain, info);
-    }
+        auto obc_solver = std::make_unique<amrex::FFT::OpenBCSolver<amrex::Real>>(domain, info);
 
-    auto const& lo = domain.smallEnd();
-    amrex::Real const dx = cell_size[0];
-    amrex::Real const dy = cell_size[1];
-    amrex::Real const dz = cell_size[2];
+        auto const& lo = domain.smallEnd();
+        amrex::Real const dx = cell_size[0];
+        amrex::Real const dy = cell_size[1];
+        amrex::Real const dz = cell_size[2];
 
-    if (!is_igf_2d_slices){
-        // fully 3D solver
-        obc_solver->setGreensFunction(
-        [=] AMREX_GPU_DEVICE (int i, int j, int k) -> amrex::Real
-        {
-            int const i0 = i - lo[0];
-            int const j0 = j - lo[1];
-            int const k0 = k - lo[2];
-            amrex::Real const x = i0*dx;
-            amrex::Real const y = j0*dy;
-            amrex::Real const z = k0*dz;
-
-            return SumOfIntegratedPotential3D(x, y, z, dx, dy, dz);
-        });
-    }else{
-        // 2D sliced solver
-        obc_solver->setGreensFunction(
-        [=] AMREX_GPU_DEVICE (int i, int j, int k) -> amrex::Real
-        {
-            int const i0 = i - lo[0];
-            int const j0 = j - lo[1];
-            amrex::Real const x = i0*dx;
-            amrex::Real const y = j0*dy;
-            amrex::ignore_unused(k);
+        // the Green's function is evaluated on the doubled grid and transformed
+        // only once per key
+        if (!is_igf_2d_slices){
+            // fully 3D solver
+            obc_solver->setGreensFunction(
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> amrex::Real
+            {
+                int const i0 = i - lo[0];
+                int const j0 = j - lo[1];
+                int const k0 = k - lo[2];
+                amrex::Real const x = i0*dx;
+                amrex::Real const y = j0*dy;
+                amrex::Real const z = k0*dz;
 
-            return SumOfIntegratedPotential2D(x, y, dx, dy);
-        });
+                return SumOfIntegratedPotential3D(x, y, z, dx, dy, dz);
+            });
+        }else{
+            // 2D sliced solver
+            obc_solver->setGreensFunction(
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> amrex::Real
+            {
+                int const i0 = i - lo[0];
+                int const j0 = j - lo[1];
+                amrex::Real const x = i0*dx;
+                amrex::Real const y = j0*dy;
+                amrex::ignore_unused(k);
+
+                return SumOfIntegratedPotential2D(x, y, dx, dy);
+            });
+
+        }
 
+        igf_solver_cache.push_front(IGFSolverCacheEntry{
+            domain, cell_size, is_igf_2d_slices, nprocs, std::move(obc_solver)});
     }
 
-    obc_solver->solve(phi, rho);
+    igf_solver_cache.front().solver->solve(phi, rho);
 } // computePhiIGF
 
 } // namespace ablastr::fields